@@ -0,0 +1,183 @@
+#include "audio_analysis.h"
+
+// First quarter of a sine, 64 steps
+static const int16_t SINE_QUARTER_Q15[65] PROGMEM = {
+    0, 804, 1608, 2410, 3212, 4011, 4808, 5602, 6393, 7179, 7962, 8739, 9512,
+    10278, 11039, 11793, 12539, 13279, 14010, 14732, 15446, 16151, 16846, 17530, 18204, 18868,
+    19519, 20159, 20787, 21403, 22005, 22594, 23170, 23731, 24279, 24811, 25329, 25832, 26319,
+    26790, 27245, 27683, 28105, 28510, 28898, 29268, 29621, 29956, 30273, 30571, 30852, 31113,
+    31356, 31580, 31785, 31971, 32137, 32285, 32412, 32521, 32609, 32678, 32728, 32757, 32767};
+
+int16_t sin_q15(uint16_t angle)
+{
+    uint8_t quarter = angle >> 14;
+    uint16_t a = angle & 0x3FFF;
+    // Second and fourth quarters run backwards
+    if (quarter & 1)
+        a = 0x4000 - a;
+    uint8_t index = a >> 8;
+    int32_t v = pgm_read_word(&SINE_QUARTER_Q15[index]);
+    if (index < 64)
+        v += ((int32_t)((int16_t)pgm_read_word(&SINE_QUARTER_Q15[index + 1]) - v) * (a & 0xFF)) >> 8;
+    return quarter & 2 ? -v : v;
+}
+
+static inline int16_t multiply_q15(int16_t a, int16_t b)
+{
+    return ((int32_t)a * b) >> 15;
+}
+
+void fft_q15(int16_t *re, int16_t *im, uint8_t log2n)
+{
+    uint16_t n = 1 << log2n;
+
+    // Bit reversed order
+    for (uint16_t i = 1, j = 0; i < n; i++)
+    {
+        uint16_t bit = n >> 1;
+        for (; j & bit; bit >>= 1)
+            j ^= bit;
+        j |= bit;
+        if (i < j)
+        {
+            int16_t t = re[i];
+            re[i] = re[j];
+            re[j] = t;
+            t = im[i];
+            im[i] = im[j];
+            im[j] = t;
+        }
+    }
+
+    for (uint8_t stage = 1; stage <= log2n; stage++)
+    {
+        uint16_t half = 1 << (stage - 1);
+        // Twiddle step, a turn over the butterfly span
+        uint16_t step = 1U << (16 - stage);
+        for (uint16_t k = 0; k < half; k++)
+        {
+            uint16_t angle = k * step;
+            int16_t wr = sin_q15(angle + 0x4000);
+            int16_t wi = -sin_q15(angle);
+            for (uint16_t i = k; i < n; i += 2 * half)
+            {
+                uint16_t j = i + half;
+                int16_t tr = multiply_q15(wr, re[j]) - multiply_q15(wi, im[j]);
+                int16_t ti = multiply_q15(wr, im[j]) + multiply_q15(wi, re[j]);
+                int16_t ur = re[i] >> 1, ui = im[i] >> 1;
+                tr >>= 1;
+                ti >>= 1;
+                re[i] = ur + tr;
+                im[i] = ui + ti;
+                re[j] = ur - tr;
+                im[j] = ui - ti;
+            }
+        }
+    }
+}
+
+void hann_q15(int16_t *samples, uint16_t count)
+{
+    // 0.5 - 0.5 cos, in Q15
+    uint16_t step = 65536UL / count;
+    for (uint16_t n = 0; n < count; n++)
+    {
+        // The peak of 1.0 is 32768, saturated to fit
+        int32_t w = 16384 - (sin_q15(n * step + 0x4000) >> 1);
+        samples[n] = multiply_q15(samples[n], w > 32767 ? 32767 : w);
+    }
+}
+
+/** |re,im| approximated as max + min / 2, no square root **/
+static inline uint16_t magnitude(int16_t re, int16_t im)
+{
+    uint16_t a = re < 0 ? -re : re;
+    uint16_t b = im < 0 ? -im : im;
+    return a > b ? a + (b >> 1) : b + (a >> 1);
+}
+
+AudioAnalyzer::AudioAnalyzer(uint8_t log2n, uint8_t bands)
+{
+    _log2n = log2n > AUDIO_FFT_MAX_LOG2 ? AUDIO_FFT_MAX_LOG2 : (log2n < 2 ? 2 : log2n);
+    _size = 1 << _log2n;
+    // Bins 1 to the Nyquist bin give at most size / 2 - 1 bands
+    uint16_t bins = _size / 2;
+    if (bands > bins - 1)
+        bands = bins - 1;
+    if (bands == 0)
+        bands = 1;
+    _bands = bands;
+    _re = new int16_t[_size];
+    _im = new int16_t[_size];
+    _bandStart = new uint16_t[bands + 1];
+    _envelope = new uint16_t[bands];
+
+    // Log spaced from bin 1 to the Nyquist bin, at least a bin each
+    _bandStart[0] = 1;
+    for (uint8_t b = 1; b <= bands; b++)
+    {
+        uint16_t start = pow(bins, (float)b / bands) + 0.5f;
+        uint16_t min = _bandStart[b - 1] + 1;
+        _bandStart[b] = start < min ? min : (start > bins ? bins : start);
+    }
+    memset(_envelope, 0, bands * sizeof(uint16_t));
+
+    attack = 192;
+    release = 24;
+    gain = 4;
+    beatThreshold = 24;
+    beatFloor = 2048;
+    beatHold = 4;
+    beats = 0;
+    _bassAverage = 0;
+    _lastBass = 0;
+    _hold = 0;
+    _beat = false;
+}
+
+AudioAnalyzer::~AudioAnalyzer()
+{
+    delete[] _re;
+    delete[] _im;
+    delete[] _bandStart;
+    delete[] _envelope;
+}
+
+void AudioAnalyzer::process(const int16_t *pcm)
+{
+    memcpy(_re, pcm, _size * sizeof(int16_t));
+    memset(_im, 0, _size * sizeof(int16_t));
+    hann_q15(_re, _size);
+    fft_q15(_re, _im, _log2n);
+
+    for (uint8_t b = 0; b < _bands; b++)
+    {
+        uint32_t sum = 0;
+        for (uint16_t k = _bandStart[b]; k < _bandStart[b + 1]; k++)
+            sum += magnitude(_re[k], _im[k]);
+        sum *= gain;
+        uint16_t l = sum > 0xFFFF ? 0xFFFF : sum;
+
+        uint16_t e = _envelope[b];
+        if (l > e)
+            e += ((uint32_t)(l - e) * attack) >> 8;
+        else
+            e -= ((uint32_t)(e - l) * release) >> 8;
+        _envelope[b] = e;
+    }
+
+    // Beats on the bass bands against their running average
+    uint32_t bass = ((uint32_t)_envelope[0] + _envelope[_bands > 1 ? 1 : 0]) >> 1;
+    _beat = false;
+    if (_hold > 0)
+        _hold--;
+    // Only rising bass, a decaying envelope stays above the average for a while
+    else if (bass > _lastBass && bass > beatFloor && bass * 16 > _bassAverage * beatThreshold)
+    {
+        _beat = true;
+        _hold = beatHold;
+        beats++;
+    }
+    _bassAverage += ((int32_t)bass - (int32_t)_bassAverage) / 16;
+    _lastBass = bass;
+}
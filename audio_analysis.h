@@ -0,0 +1,118 @@
+/*
+ * audio_analysis.h
+ *
+ * Audio reactive stage: blocks of 16 bit PCM go through a Q15 radix-2 FFT,
+ * the spectrum is grouped in bands with attack/release envelopes and the low
+ * bands feed a beat detector. AudioModulation maps the results onto amp,
+ * speed and k_param of Functions. Work per block is fixed, so results are at
+ * most one block late.
+ */
+
+#ifndef AUDIO_ANALYSIS_H_
+#define AUDIO_ANALYSIS_H_
+
+#include <Arduino.h>
+#include "color_animation.h"
+
+#define AUDIO_FFT_MAX_LOG2 10
+
+/** Q15 sine, a full turn of @angle is 65536 **/
+int16_t sin_q15(uint16_t angle);
+
+/** In place radix-2 FFT of 2^@log2n Q15 samples. Each stage halves the values,
+ *  so the outputs are the DFT divided by the size and never overflow. **/
+void fft_q15(int16_t *re, int16_t *im, uint8_t log2n);
+
+/** Applies a Hann window to @count Q15 samples **/
+void hann_q15(int16_t *samples, uint16_t count);
+
+class AudioAnalyzer
+{
+
+protected:
+	uint8_t _log2n;
+	uint16_t _size;
+	uint8_t _bands;
+	int16_t *_re;
+	int16_t *_im;
+	/** First FFT bin of each band, plus the end of the last one **/
+	uint16_t *_bandStart;
+	uint16_t *_envelope;
+	uint32_t _bassAverage;
+	uint32_t _lastBass;
+	uint8_t _hold;
+	bool _beat;
+
+public:
+	/** Envelope rise and fall per block, /256 of the distance to the band level **/
+	uint8_t attack;
+	uint8_t release;
+	/** Band level = magnitude sum * gain, saturated to 16 bits **/
+	uint16_t gain;
+	/** Beat when bass exceeds its average * beatThreshold / 16 **/
+	uint8_t beatThreshold;
+	/** Bass level below which there are no beats **/
+	uint16_t beatFloor;
+	/** Blocks after a beat with no other beat **/
+	uint8_t beatHold;
+	/** Beats detected so far **/
+	unsigned long beats;
+
+	/** @log2n FFT size 2^log2n in [2,AUDIO_FFT_MAX_LOG2], @bands log spaced bands, at most 2^(log2n-1) - 1 **/
+	AudioAnalyzer(uint8_t log2n = 7, uint8_t bands = 8);
+	/** Owns its buffers, copies would free them twice **/
+	AudioAnalyzer(const AudioAnalyzer &) = delete;
+	AudioAnalyzer &operator=(const AudioAnalyzer &) = delete;
+
+	virtual ~AudioAnalyzer();
+
+	/** Samples per block **/
+	uint16_t size() { return _size; }
+
+	uint8_t bands() { return _bands; }
+
+	/** Analyzes one block of size() samples **/
+	void process(const int16_t *pcm);
+
+	/** Band envelope [0,65535] **/
+	uint16_t envelope(uint8_t band) { return _envelope[band]; }
+
+	/** Band envelope [0,1] **/
+	float level(uint8_t band) { return _envelope[band] / 65535.0f; }
+
+	/** True if the last block had a beat **/
+	bool isBeat() { return _beat; }
+};
+
+/** Maps a band envelope to parameters, parameter = base + depth * level **/
+class AudioModulation
+{
+
+public:
+	uint8_t band;
+	float ampBase, ampDepth;
+	float speedBase, speedDepth;
+	float kBase, kDepth;
+	/** Added to amp on blocks with a beat **/
+	float beatAmp;
+
+	AudioModulation(uint8_t b = 0)
+		: band(b), ampBase(1), ampDepth(0), speedBase(1), speedDepth(0), kBase(0.5), kDepth(0), beatAmp(0) {}
+
+	/** Sets speed and k_param of @f **/
+	void apply(AudioAnalyzer &analyzer, Functions &f)
+	{
+		float l = analyzer.level(band);
+		f.speed = speedBase + speedDepth * l;
+		f.k_param = kBase + kDepth * l;
+	}
+
+	/** Sets amp, speed and k_param of @f **/
+	void apply(AudioAnalyzer &analyzer, AnimationFunctions &f)
+	{
+		apply(analyzer, (Functions &)f);
+		f.amp = ampBase + ampDepth * analyzer.level(band) + (analyzer.isBeat() ? beatAmp : 0);
+	}
+};
+
+#endif /* AUDIO_ANALYSIS_H_ */
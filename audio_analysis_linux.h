@@ -0,0 +1,92 @@
+/*
+ * audio_analysis_linux.h
+ *
+ * PCM input for AudioAnalyzer on Linux hosts: raw signed 16 bit little endian
+ * samples from a file, a pipe or stdin, e.g. the output of arecord -t raw.
+ */
+
+#ifndef AUDIO_ANALYSIS_LINUX_H_
+#define AUDIO_ANALYSIS_LINUX_H_
+
+#include "audio_analysis.h"
+
+#include <fcntl.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <vector>
+
+class PcmSource
+{
+
+protected:
+	int _fd;
+	bool _owned;
+	uint8_t _channels;
+	std::vector<int16_t> _frame;
+
+	/** Reads exactly @bytes, pipes may return less per call **/
+	bool readAll(uint8_t *buffer, size_t bytes)
+	{
+		while (bytes > 0)
+		{
+			ssize_t n = ::read(_fd, buffer, bytes);
+			if (n <= 0)
+				return false;
+			buffer += n;
+			bytes -= n;
+		}
+		return true;
+	}
+
+public:
+	/** Opens @path, "-" reads stdin **/
+	PcmSource(const char *path, uint8_t channels = 1) : _channels(channels)
+	{
+		_owned = strcmp(path, "-") != 0;
+		_fd = _owned ? ::open(path, O_RDONLY) : STDIN_FILENO;
+	}
+
+	/** Reads from an already open @fd, not closed by the source **/
+	PcmSource(int fd, uint8_t channels = 1) : _fd(fd), _owned(false), _channels(channels) {}
+
+	virtual ~PcmSource()
+	{
+		if (_owned && _fd >= 0)
+			::close(_fd);
+	}
+
+	bool isOpen() { return _fd >= 0; }
+
+	/** Reads @count mono samples, channels are averaged. False at the end of the stream. **/
+	bool read(int16_t *block, uint16_t count)
+	{
+		if (_fd < 0)
+			return false;
+		if (_channels <= 1)
+			return readAll((uint8_t *)block, count * sizeof(int16_t));
+
+		_frame.resize((size_t)count * _channels);
+		if (!readAll((uint8_t *)_frame.data(), _frame.size() * sizeof(int16_t)))
+			return false;
+		for (uint16_t n = 0; n < count; n++)
+		{
+			int32_t sum = 0;
+			for (uint8_t c = 0; c < _channels; c++)
+				sum += _frame[(size_t)n * _channels + c];
+			block[n] = sum / _channels;
+		}
+		return true;
+	}
+
+	/** Reads one block and analyzes it **/
+	bool process(AudioAnalyzer &analyzer, int16_t *block)
+	{
+		if (!read(block, analyzer.size()))
+			return false;
+		analyzer.process(block);
+		return true;
+	}
+};
+
+#endif /* AUDIO_ANALYSIS_LINUX_H_ */
@@ -15,6 +15,8 @@
 // #endif
 #include "rgb_utils.h"
 #include "functions.h"
+#include "easing.h"
+#include "xorshift.h"
 
 // EFFECT MODES
 #define NO_ANIMATION 0
@@ -29,6 +31,10 @@ static const NPeriodicData<2> FAST_RAINBOW_PD = {Functions::COSINES,2, {0.5, 0.5
 // static const PeriodicDataT<2> CIRCLE_RAINBOW_PD = {Functions::CIRCLES,2, {0.9, 0.1}, {0.1, 1}, {0.0, 0}};
 static const NPeriodicData<2> CIRCLE_RAINBOW_PD = {Functions::CIRCLES,1, {1}, {0.1}, {0}};
 static const NPeriodicData<2> BEAT_PD = {Functions::COSINES,2, {0.5, 0.5}, {0, BEAT_FREQ}, {0.0, PI}};
+// Random programs, steps per second
+#define CANDLE_FLICKER_RATE 12
+#define TWINKLE_RATE 2
+#define SPARKLE_RATE 8
 
 class AnimationFunctions : public Functions
 {
@@ -43,18 +49,96 @@ public:
 		RAINBOW1,
 		RAINBOW2,
 		FAST_RAINBOW,
-		CIRCLE_RAINBOW
+		CIRCLE_RAINBOW,
+		CANDLE_FLICKER,
+		TWINKLE,
+		SPARKLE
 	} FunctionTypes;
 
 	float amp;
 	bool positive;
 	byte program;
+	/** Easing curve applied to output(), EASE_LINEAR leaves it untouched **/
+	uint8_t easing;
+	/** Generator of the random programs **/
+	XorShift32 rng;
 
-	AnimationFunctions() : Functions()
+protected:
+	// Random programs state, levels of last and next step
+	uint16_t _step;
+	uint8_t _from, _to;
+
+	void resetSteps()
+	{
+		_step = 0;
+		_from = _to = 255;
+	}
+
+	/** Level of the next random step **/
+	uint8_t nextLevel()
 	{
-		positive = false;
-		program = NO_FUNCTION;
+		switch (program)
+		{
+		case CANDLE_FLICKER:
+			// Shallow flicker and sometimes a deeper dip, k_param is the depth
+			return 255 - rng.below((rng.chance(24) ? 1.0f : 0.4f) * k_param * 255);
+		case TWINKLE:
+		case SPARKLE:
+			// k_param is the chance of a step being lit
+			return rng.chance(k_param * 255) ? 255 : 0;
+		default:
+			return 0;
+		}
+	}
+
+public:
+	/** Constant initialized as Functions, @amplitude scales output() **/
+	explicit constexpr AnimationFunctions(float amplitude = 1)
+		: Functions(), amp(amplitude), positive(false), program(NO_FUNCTION), easing(EASE_LINEAR), rng(),
+		  _step(0), _from(255), _to(255)
+	{
+	}
+
+	/** Seeds the random programs, same seed same sequence **/
+	void seed(uint32_t s)
+	{
+		rng.seed(s);
+		resetSteps();
+	}
+
+	/** Random programs value [0,1], steps at the base frequency **/
+	float randomValue()
+	{
+		float steps = t() * *_freqs;
+		uint16_t step = (uint16_t)(unsigned long)steps;
+		float frac = steps - (unsigned long)steps;
+
+		// Long gaps between calls and timer resets skip to the current step
+		if ((uint16_t)(step - _step) > 2)
+			_step = step - 1;
+		while (_step != step)
+		{
+			_from = _to;
+			_to = nextLevel();
+			_step++;
+		}
+
+		switch (program)
+		{
+		case CANDLE_FLICKER:
+			return (_from + (_to - _from) * frac) / 255.0f;
+		case TWINKLE:
+			// Fades in and out within the step
+			return (_to / 255.0f) * (frac < 0.5f ? 2.0f * frac : 2.0f - 2.0f * frac);
+		case SPARKLE:
+			frac = 1.0f - frac;
+			return (_to / 255.0f) * frac * frac;
+		default:
+			return 0.0f;
+		}
 	}
+
+	bool isRandom() { return program >= CANDLE_FLICKER && program <= SPARKLE; }
 	virtual ~AnimationFunctions(){
 
 	}
@@ -125,6 +209,21 @@ public:
 				setPeriodicData(CIRCLE_RAINBOW_PD.size, (float *)CIRCLE_RAINBOW_PD.amps, (float *)CIRCLE_RAINBOW_PD.freqs, (float *)CIRCLE_RAINBOW_PD.phases);
 
 				break;
+			case CANDLE_FLICKER:
+				setFunctionType(NO_FUNCTION);
+				setPeriodicData(1.0, CANDLE_FLICKER_RATE, 0.0);
+				resetSteps();
+				break;
+			case TWINKLE:
+				setFunctionType(NO_FUNCTION);
+				setPeriodicData(1.0, TWINKLE_RATE, 0.0);
+				resetSteps();
+				break;
+			case SPARKLE:
+				setFunctionType(NO_FUNCTION);
+				setPeriodicData(1.0, SPARKLE_RATE, 0.0);
+				resetSteps();
+				break;
 
 			default:
 				break;
@@ -134,7 +233,16 @@ public:
 
 	float output()
 	{
-		return amp * (positive ? positiveWave(value()) : value());
+		if (isRandom())
+			return amp * randomValue();
+
+		float v = positive ? positiveWave(value()) : value();
+		if (easing != EASE_LINEAR)
+		{
+			// Curves work on [0,1], signed outputs are eased around 0
+			v = positive ? ease(easing, v) : 2.0f * ease(easing, 0.5f * (v + 1.0f)) - 1.0f;
+		}
+		return amp * v;
 	}
 
 	bool isAnimating(){
@@ -150,17 +258,19 @@ public:
 	AnimationFunctions hueAnimation;
 	// byte animationMode;
 
+	/** Hue the animation rotates from, binary degrees **/
 	uint16_t _prevHue;
 
-	ColorAnimation() : Color(), brightnessAnimation(), hueAnimation()
+	/** Constant initialized, no heap or startup code for globals **/
+	constexpr ColorAnimation()
+		: Color(), brightnessAnimation(BRIGHTNESS_MAX), hueAnimation(HUE_MAX), _prevHue(0)
 	{
-		brightnessAnimation.amp = BRIGHTNESS_MAX;
-		hueAnimation.amp = HUE_MAX;
-
-		brightnessAnimation.speed = hueAnimation.speed = 1;
 	}
 	virtual ~ColorAnimation() {}
 
+	/** Starts the animation timers, call from setup() **/
+	void begin() { resetAllTimers(); }
+
 	// Color *color() { return (Color *)this; }
 
 	void resetAllTimers()
@@ -169,6 +279,13 @@ public:
 		hueAnimation.resetTimer();
 	}
 
+	/** Seeds the random animations **/
+	void seed(uint32_t s)
+	{
+		brightnessAnimation.seed(s);
+		hueAnimation.seed(s + 1);
+	}
+
 	void setBrightnessAnimation(byte animation)
 	{
 		brightnessAnimation.setProgram(animation);
@@ -185,10 +302,13 @@ public:
 
 	void setColorAnimation(byte animation)
 	{
+		bool wasAnimating = hueAnimation.isAnimating();
 		hueAnimation.setProgram(animation);
 		if (animation == NO_ANIMATION)
 		{
-			setHue(_prevHue);
+			// Restore the hue only if an animation had changed it
+			if (wasAnimating)
+				setHue16(_prevHue);
 		}
 		else
 		{
@@ -211,6 +331,15 @@ public:
 
 			setBrightnessAnimation(AnimationFunctions::BEATING);
 		}
+		else if (animation == AnimationFunctions::CANDLE_FLICKER)
+		{
+			setTemperature(ColorTone::candle, BRIGHTNESS_MAX);
+			setBrightnessAnimation(animation);
+		}
+		else if (animation == AnimationFunctions::TWINKLE || animation == AnimationFunctions::SPARKLE)
+		{
+			setBrightnessAnimation(animation);
+		}
 		else
 		{
 			setColorAnimation(animation);
@@ -221,7 +350,7 @@ public:
 	bool beatColor2Zero()
 	{
 		setBrightness(brightnessAnimation.beat());
-		return (_brightness > 1);
+		return (brightness() > 1);
 	}
 
 	//	void beatColor2Zero(){
@@ -246,10 +375,12 @@ public:
 	// 	setHue(hue + _prevHue);
 	// }
 
-	// void allRandom()
-	// {
-	// 	setRGB(random(0, 255), random(0, 255), random(0, 255));
-	// }
+	/** Random color from the hue animation generator **/
+	void allRandom()
+	{
+		uint32_t c = hueAnimation.rng.next();
+		setRGB(c, c >> 8, c >> 16);
+	}
 
 
 	void updateAnimation()
@@ -257,7 +388,8 @@ public:
 
 		
 		if (isColorAnimating()){
-			setHue(_prevHue  +hueAnimation.output() );
+			// Degrees to binary degrees, any offset wraps by overflow
+			setHue16(_prevHue + (uint16_t)(int32_t)(hueAnimation.output() * HUE16_PER_DEGREE));
 		}
 
 		setBrightness(brightnessAnimation.isAnimating() ? (uint8_t)brightnessAnimation.output() : BRIGHTNESS_MAX);
@@ -0,0 +1,150 @@
+#include "color_names.h"
+#include "colors_table.h"
+
+static inline char normalize_char(char c)
+{
+    if (c >= 'A' && c <= 'Z')
+        return c - 'A' + 'a';
+    if (c == ' ' || c == '-')
+        return '_';
+    return c;
+}
+
+/** FNV-1a, must match name_hash() in def_colors.py **/
+static uint32_t name_hash(const char *name, uint32_t seed)
+{
+    uint32_t h = 2166136261UL ^ seed;
+    while (*name)
+    {
+        h = (h ^ (uint8_t)normalize_char(*name++)) * 16777619UL;
+    }
+    return h ^ (h >> 16);
+}
+
+int16_t color_id(const char *name)
+{
+    uint8_t seed = pgm_read_byte(&COLOR_NAME_SEEDS[name_hash(name, 0) & (COLOR_NAMES_BUCKETS - 1)]);
+    uint16_t id = pgm_read_word(&COLOR_NAME_SLOTS[name_hash(name, seed) & (COLOR_NAMES_SLOTS - 1)]);
+
+    if (id >= COLOR_NAMES_COUNT)
+        return -1;
+
+    // Any string hashes to some slot, check it is really that name
+    PGM_P stored = (PGM_P)pgm_read_ptr(&COLOR_NAMES[id]);
+    char c;
+    do
+    {
+        c = pgm_read_byte(stored++);
+        if (c != normalize_char(*name++))
+            return -1;
+    } while (c != '\0');
+
+    return id;
+}
+
+bool color_from_name(const char *name, RGBOutput &out)
+{
+    int16_t id = color_id(name);
+    if (id < 0)
+        return false;
+    out = color_from_id(id);
+    return true;
+}
+
+RGBOutput color_from_id(uint16_t id)
+{
+    if (id >= COLOR_NAMES_COUNT)
+        return RGBOutput();
+    return RGBOutput(pgm_read_byte(&COLOR_RGB[id][0]), pgm_read_byte(&COLOR_RGB[id][1]), pgm_read_byte(&COLOR_RGB[id][2]));
+}
+
+void color_name(uint16_t id, char *out, size_t size)
+{
+    if (size == 0)
+        return;
+    if (id >= COLOR_NAMES_COUNT)
+    {
+        out[0] = '\0';
+        return;
+    }
+    strncpy_P(out, (PGM_P)pgm_read_ptr(&COLOR_NAMES[id]), size - 1);
+    out[size - 1] = '\0';
+}
+
+/** Weighted RGB squared distance, weights must match DISTANCE_WEIGHTS in def_colors.py **/
+static const uint8_t DISTANCE_WEIGHTS[3] = {2, 4, 3};
+
+static inline uint32_t color_distance(const uint8_t *a, const uint8_t *b)
+{
+    uint32_t d = 0;
+    for (uint8_t n = 0; n < 3; n++)
+    {
+        int16_t diff = (int16_t)a[n] - b[n];
+        d += (uint32_t)DISTANCE_WEIGHTS[n] * (uint32_t)(diff * diff);
+    }
+    return d;
+}
+
+/** Nearer wins, equal distances go to the lower id so results match the linear scan **/
+static inline void nearest_check(const uint8_t *q, uint16_t id, uint16_t &best, uint32_t &bestDistance)
+{
+    uint8_t c[3];
+    memcpy_P(c, COLOR_RGB[id], 3);
+    uint32_t d = color_distance(q, c);
+    if (d < bestDistance || (d == bestDistance && id < best))
+    {
+        best = id;
+        bestDistance = d;
+    }
+}
+
+static void kd_search(const uint8_t *q, uint16_t lo, uint16_t hi, uint16_t &best, uint32_t &bestDistance)
+{
+    while (lo < hi)
+    {
+        uint16_t mid = (lo + hi) / 2;
+        uint16_t node = pgm_read_word(&COLOR_KD_TREE[mid]);
+        uint16_t id = node & 0x3FFF;
+        uint8_t axis = node >> 14;
+
+        nearest_check(q, id, best, bestDistance);
+
+        int16_t diff = (int16_t)q[axis] - pgm_read_byte(&COLOR_RGB[id][axis]);
+        uint32_t planeDistance = (uint32_t)DISTANCE_WEIGHTS[axis] * (uint32_t)(diff * diff);
+
+        // Near side first, far side only if the split plane is not farther than the best match
+        if (diff < 0)
+        {
+            kd_search(q, lo, mid, best, bestDistance);
+            if (planeDistance > bestDistance)
+                return;
+            lo = mid + 1;
+        }
+        else
+        {
+            kd_search(q, mid + 1, hi, best, bestDistance);
+            if (planeDistance > bestDistance)
+                return;
+            hi = mid;
+        }
+    }
+}
+
+uint16_t color_nearest(uint8_t red, uint8_t green, uint8_t blue)
+{
+    const uint8_t q[3] = {red, green, blue};
+    uint16_t best = 0xFFFF;
+    uint32_t bestDistance = 0xFFFFFFFF;
+    kd_search(q, 0, COLOR_NAMES_COUNT, best, bestDistance);
+    return best;
+}
+
+uint16_t color_nearest_linear(uint8_t red, uint8_t green, uint8_t blue)
+{
+    const uint8_t q[3] = {red, green, blue};
+    uint16_t best = 0xFFFF;
+    uint32_t bestDistance = 0xFFFFFFFF;
+    for (uint16_t id = 0; id < COLOR_NAMES_COUNT; id++)
+        nearest_check(q, id, best, bestDistance);
+    return best;
+}
@@ -0,0 +1,37 @@
+/*
+ * color_names.h
+ *
+ * Runtime lookup of the colors.json named colors, e.g. a name received by
+ * serial or MQTT. Tables live in flash and are generated by def_colors.py.
+ */
+
+#ifndef COLOR_NAMES_H_
+#define COLOR_NAMES_H_
+
+#include <Arduino.h>
+#include "rgb_utils.h"
+#include "colors_ids.h"
+
+/** Returns the ColorId of @name or -1 if unknown.
+ *  Names are the colors.json keys, case insensitive and ' ' or '-' matching '_'.
+ **/
+int16_t color_id(const char *name);
+
+/** Sets @out to the color named @name, returns false if unknown **/
+bool color_from_name(const char *name, RGBOutput &out);
+
+/** Returns color @id RGB **/
+RGBOutput color_from_id(uint16_t id);
+
+/** Copies color @id name to @out (at most @size bytes with the ending '\0') **/
+void color_name(uint16_t id, char *out, size_t size);
+
+/** Returns the id of the named color nearest to @red, @green, @blue.
+ *  Exact search in a k-d tree over weighted RGB distance 2*dr^2 + 4*dg^2 + 3*db^2.
+ **/
+uint16_t color_nearest(uint8_t red, uint8_t green, uint8_t blue);
+
+/** Same result as color_nearest() by checking every color, reference for tests and benchmarks **/
+uint16_t color_nearest_linear(uint8_t red, uint8_t green, uint8_t blue);
+
+#endif /* COLOR_NAMES_H_ */
@@ -0,0 +1,877 @@
+#ifndef COLORS_IDS_H_
+#define COLORS_IDS_H_
+
+// Generated by def_colors.py from colors.json
+
+#define COLOR_NAMES_COUNT 865
+
+typedef enum
+{
+    COLOR_ID_AIR_FORCE_BLUE_RAF,
+    COLOR_ID_AIR_FORCE_BLUE_USAF,
+    COLOR_ID_AIR_SUPERIORITY_BLUE,
+    COLOR_ID_ALABAMA_CRIMSON,
+    COLOR_ID_ALICE_BLUE,
+    COLOR_ID_ALIZARIN_CRIMSON,
+    COLOR_ID_ALLOY_ORANGE,
+    COLOR_ID_ALMOND,
+    COLOR_ID_AMARANTH,
+    COLOR_ID_AMBER,
+    COLOR_ID_AMBER_SAE_ECE,
+    COLOR_ID_AMERICAN_ROSE,
+    COLOR_ID_AMETHYST,
+    COLOR_ID_ANDROID_GREEN,
+    COLOR_ID_ANTI_FLASH_WHITE,
+    COLOR_ID_ANTIQUE_BRASS,
+    COLOR_ID_ANTIQUE_FUCHSIA,
+    COLOR_ID_ANTIQUE_RUBY,
+    COLOR_ID_ANTIQUE_WHITE,
+    COLOR_ID_AO_ENGLISH,
+    COLOR_ID_APPLE_GREEN,
+    COLOR_ID_APRICOT,
+    COLOR_ID_AQUA,
+    COLOR_ID_AQUAMARINE,
+    COLOR_ID_ARMY_GREEN,
+    COLOR_ID_ARSENIC,
+    COLOR_ID_ARYLIDE_YELLOW,
+    COLOR_ID_ASH_GREY,
+    COLOR_ID_ASPARAGUS,
+    COLOR_ID_ATOMIC_TANGERINE,
+    COLOR_ID_AUBURN,
+    COLOR_ID_AUREOLIN,
+    COLOR_ID_AUROMETALSAURUS,
+    COLOR_ID_AVOCADO,
+    COLOR_ID_AZURE,
+    COLOR_ID_AZURE_MIST_WEB,
+    COLOR_ID_BABY_BLUE,
+    COLOR_ID_BABY_BLUE_EYES,
+    COLOR_ID_BABY_PINK,
+    COLOR_ID_BALL_BLUE,
+    COLOR_ID_BANANA_MANIA,
+    COLOR_ID_BANANA_YELLOW,
+    COLOR_ID_BARN_RED,
+    COLOR_ID_BATTLESHIP_GREY,
+    COLOR_ID_BAZAAR,
+    COLOR_ID_BEAU_BLUE,
+    COLOR_ID_BEAVER,
+    COLOR_ID_BEIGE,
+    COLOR_ID_BIG_DIP_O_RUBY,
+    COLOR_ID_BISQUE,
+    COLOR_ID_BISTRE,
+    COLOR_ID_BITTERSWEET,
+    COLOR_ID_BITTERSWEET_SHIMMER,
+    COLOR_ID_BLACK,
+    COLOR_ID_BLACK_BEAN,
+    COLOR_ID_BLACK_LEATHER_JACKET,
+    COLOR_ID_BLACK_OLIVE,
+    COLOR_ID_BLANCHED_ALMOND,
+    COLOR_ID_BLAST_OFF_BRONZE,
+    COLOR_ID_BLEU_DE_FRANCE,
+    COLOR_ID_BLIZZARD_BLUE,
+    COLOR_ID_BLOND,
+    COLOR_ID_BLUE,
+    COLOR_ID_BLUE_BELL,
+    COLOR_ID_BLUE_CRAYOLA,
+    COLOR_ID_BLUE_GRAY,
+    COLOR_ID_BLUE_GREEN,
+    COLOR_ID_BLUE_MUNSELL,
+    COLOR_ID_BLUE_NCS,
+    COLOR_ID_BLUE_PIGMENT,
+    COLOR_ID_BLUE_RYB,
+    COLOR_ID_BLUE_SAPPHIRE,
+    COLOR_ID_BLUE_VIOLET,
+    COLOR_ID_BLUSH,
+    COLOR_ID_BOLE,
+    COLOR_ID_BONDI_BLUE,
+    COLOR_ID_BONE,
+    COLOR_ID_BOSTON_UNIVERSITY_RED,
+    COLOR_ID_BOTTLE_GREEN,
+    COLOR_ID_BOYSENBERRY,
+    COLOR_ID_BRANDEIS_BLUE,
+    COLOR_ID_BRASS,
+    COLOR_ID_BRICK_RED,
+    COLOR_ID_BRIGHT_CERULEAN,
+    COLOR_ID_BRIGHT_GREEN,
+    COLOR_ID_BRIGHT_LAVENDER,
+    COLOR_ID_BRIGHT_MAROON,
+    COLOR_ID_BRIGHT_PINK,
+    COLOR_ID_BRIGHT_TURQUOISE,
+    COLOR_ID_BRIGHT_UBE,
+    COLOR_ID_BRILLIANT_LAVENDER,
+    COLOR_ID_BRILLIANT_ROSE,
+    COLOR_ID_BRINK_PINK,
+    COLOR_ID_BRITISH_RACING_GREEN,
+    COLOR_ID_BRONZE,
+    COLOR_ID_BROWN_TRADITIONAL,
+    COLOR_ID_BROWN_WEB,
+    COLOR_ID_BUBBLE_GUM,
+    COLOR_ID_BUBBLES,
+    COLOR_ID_BUFF,
+    COLOR_ID_BULGARIAN_ROSE,
+    COLOR_ID_BURGUNDY,
+    COLOR_ID_BURLYWOOD,
+    COLOR_ID_BURNT_ORANGE,
+    COLOR_ID_BURNT_SIENNA,
+    COLOR_ID_BURNT_UMBER,
+    COLOR_ID_BYZANTINE,
+    COLOR_ID_BYZANTIUM,
+    COLOR_ID_CADET,
+    COLOR_ID_CADET_BLUE,
+    COLOR_ID_CADET_GREY,
+    COLOR_ID_CADMIUM_GREEN,
+    COLOR_ID_CADMIUM_ORANGE,
+    COLOR_ID_CADMIUM_RED,
+    COLOR_ID_CADMIUM_YELLOW,
+    COLOR_ID_CAF_AU_LAIT,
+    COLOR_ID_CAF_NOIR,
+    COLOR_ID_CAL_POLY_GREEN,
+    COLOR_ID_CAMBRIDGE_BLUE,
+    COLOR_ID_CAMEL,
+    COLOR_ID_CAMEO_PINK,
+    COLOR_ID_CAMOUFLAGE_GREEN,
+    COLOR_ID_CANARY_YELLOW,
+    COLOR_ID_CANDY_APPLE_RED,
+    COLOR_ID_CANDY_PINK,
+    COLOR_ID_CAPRI,
+    COLOR_ID_CAPUT_MORTUUM,
+    COLOR_ID_CARDINAL,
+    COLOR_ID_CARIBBEAN_GREEN,
+    COLOR_ID_CARMINE,
+    COLOR_ID_CARMINE_M_P,
+    COLOR_ID_CARMINE_PINK,
+    COLOR_ID_CARMINE_RED,
+    COLOR_ID_CARNATION_PINK,
+    COLOR_ID_CARNELIAN,
+    COLOR_ID_CAROLINA_BLUE,
+    COLOR_ID_CARROT_ORANGE,
+    COLOR_ID_CATALINA_BLUE,
+    COLOR_ID_CEIL,
+    COLOR_ID_CELADON,
+    COLOR_ID_CELADON_BLUE,
+    COLOR_ID_CELADON_GREEN,
+    COLOR_ID_CELESTE_COLOUR,
+    COLOR_ID_CELESTIAL_BLUE,
+    COLOR_ID_CERISE,
+    COLOR_ID_CERISE_PINK,
+    COLOR_ID_CERULEAN,
+    COLOR_ID_CERULEAN_BLUE,
+    COLOR_ID_CERULEAN_FROST,
+    COLOR_ID_CG_BLUE,
+    COLOR_ID_CG_RED,
+    COLOR_ID_CHAMOISEE,
+    COLOR_ID_CHAMPAGNE,
+    COLOR_ID_CHARCOAL,
+    COLOR_ID_CHARM_PINK,
+    COLOR_ID_CHARTREUSE_TRADITIONAL,
+    COLOR_ID_CHARTREUSE_WEB,
+    COLOR_ID_CHERRY,
+    COLOR_ID_CHERRY_BLOSSOM_PINK,
+    COLOR_ID_CHESTNUT,
+    COLOR_ID_CHINA_PINK,
+    COLOR_ID_CHINA_ROSE,
+    COLOR_ID_CHINESE_RED,
+    COLOR_ID_CHOCOLATE_TRADITIONAL,
+    COLOR_ID_CHOCOLATE_WEB,
+    COLOR_ID_CHROME_YELLOW,
+    COLOR_ID_CINEREOUS,
+    COLOR_ID_CINNABAR,
+    COLOR_ID_CINNAMON,
+    COLOR_ID_CITRINE,
+    COLOR_ID_CLASSIC_ROSE,
+    COLOR_ID_COBALT,
+    COLOR_ID_COCOA_BROWN,
+    COLOR_ID_COFFEE,
+    COLOR_ID_COLUMBIA_BLUE,
+    COLOR_ID_CONGO_PINK,
+    COLOR_ID_COOL_BLACK,
+    COLOR_ID_COOL_GREY,
+    COLOR_ID_COPPER,
+    COLOR_ID_COPPER_CRAYOLA,
+    COLOR_ID_COPPER_PENNY,
+    COLOR_ID_COPPER_RED,
+    COLOR_ID_COPPER_ROSE,
+    COLOR_ID_COQUELICOT,
+    COLOR_ID_CORAL,
+    COLOR_ID_CORAL_PINK,
+    COLOR_ID_CORAL_RED,
+    COLOR_ID_CORDOVAN,
+    COLOR_ID_CORN,
+    COLOR_ID_CORNELL_RED,
+    COLOR_ID_CORNFLOWER_BLUE,
+    COLOR_ID_CORNSILK,
+    COLOR_ID_COSMIC_LATTE,
+    COLOR_ID_COTTON_CANDY,
+    COLOR_ID_CREAM,
+    COLOR_ID_CRIMSON,
+    COLOR_ID_CRIMSON_GLORY,
+    COLOR_ID_CYAN,
+    COLOR_ID_CYAN_PROCESS,
+    COLOR_ID_DAFFODIL,
+    COLOR_ID_DANDELION,
+    COLOR_ID_DARK_BLUE,
+    COLOR_ID_DARK_BROWN,
+    COLOR_ID_DARK_BYZANTIUM,
+    COLOR_ID_DARK_CANDY_APPLE_RED,
+    COLOR_ID_DARK_CERULEAN,
+    COLOR_ID_DARK_CHESTNUT,
+    COLOR_ID_DARK_CORAL,
+    COLOR_ID_DARK_CYAN,
+    COLOR_ID_DARK_ELECTRIC_BLUE,
+    COLOR_ID_DARK_GOLDENROD,
+    COLOR_ID_DARK_GRAY,
+    COLOR_ID_DARK_GREEN,
+    COLOR_ID_DARK_IMPERIAL_BLUE,
+    COLOR_ID_DARK_JUNGLE_GREEN,
+    COLOR_ID_DARK_KHAKI,
+    COLOR_ID_DARK_LAVA,
+    COLOR_ID_DARK_LAVENDER,
+    COLOR_ID_DARK_MAGENTA,
+    COLOR_ID_DARK_MIDNIGHT_BLUE,
+    COLOR_ID_DARK_OLIVE_GREEN,
+    COLOR_ID_DARK_ORANGE,
+    COLOR_ID_DARK_ORCHID,
+    COLOR_ID_DARK_PASTEL_BLUE,
+    COLOR_ID_DARK_PASTEL_GREEN,
+    COLOR_ID_DARK_PASTEL_PURPLE,
+    COLOR_ID_DARK_PASTEL_RED,
+    COLOR_ID_DARK_PINK,
+    COLOR_ID_DARK_POWDER_BLUE,
+    COLOR_ID_DARK_RASPBERRY,
+    COLOR_ID_DARK_RED,
+    COLOR_ID_DARK_SALMON,
+    COLOR_ID_DARK_SCARLET,
+    COLOR_ID_DARK_SEA_GREEN,
+    COLOR_ID_DARK_SIENNA,
+    COLOR_ID_DARK_SLATE_BLUE,
+    COLOR_ID_DARK_SLATE_GRAY,
+    COLOR_ID_DARK_SPRING_GREEN,
+    COLOR_ID_DARK_TAN,
+    COLOR_ID_DARK_TANGERINE,
+    COLOR_ID_DARK_TAUPE,
+    COLOR_ID_DARK_TERRA_COTTA,
+    COLOR_ID_DARK_TURQUOISE,
+    COLOR_ID_DARK_VIOLET,
+    COLOR_ID_DARK_YELLOW,
+    COLOR_ID_DARTMOUTH_GREEN,
+    COLOR_ID_DAVY_S_GREY,
+    COLOR_ID_DEBIAN_RED,
+    COLOR_ID_DEEP_CARMINE,
+    COLOR_ID_DEEP_CARMINE_PINK,
+    COLOR_ID_DEEP_CARROT_ORANGE,
+    COLOR_ID_DEEP_CERISE,
+    COLOR_ID_DEEP_CHAMPAGNE,
+    COLOR_ID_DEEP_CHESTNUT,
+    COLOR_ID_DEEP_COFFEE,
+    COLOR_ID_DEEP_FUCHSIA,
+    COLOR_ID_DEEP_JUNGLE_GREEN,
+    COLOR_ID_DEEP_LILAC,
+    COLOR_ID_DEEP_MAGENTA,
+    COLOR_ID_DEEP_PEACH,
+    COLOR_ID_DEEP_PINK,
+    COLOR_ID_DEEP_RUBY,
+    COLOR_ID_DEEP_SAFFRON,
+    COLOR_ID_DEEP_SKY_BLUE,
+    COLOR_ID_DEEP_TUSCAN_RED,
+    COLOR_ID_DENIM,
+    COLOR_ID_DESERT,
+    COLOR_ID_DESERT_SAND,
+    COLOR_ID_DIM_GRAY,
+    COLOR_ID_DODGER_BLUE,
+    COLOR_ID_DOGWOOD_ROSE,
+    COLOR_ID_DOLLAR_BILL,
+    COLOR_ID_DRAB,
+    COLOR_ID_DUKE_BLUE,
+    COLOR_ID_EARTH_YELLOW,
+    COLOR_ID_EBONY,
+    COLOR_ID_ECRU,
+    COLOR_ID_EGGPLANT,
+    COLOR_ID_EGGSHELL,
+    COLOR_ID_EGYPTIAN_BLUE,
+    COLOR_ID_ELECTRIC_BLUE,
+    COLOR_ID_ELECTRIC_CRIMSON,
+    COLOR_ID_ELECTRIC_CYAN,
+    COLOR_ID_ELECTRIC_GREEN,
+    COLOR_ID_ELECTRIC_INDIGO,
+    COLOR_ID_ELECTRIC_LAVENDER,
+    COLOR_ID_ELECTRIC_LIME,
+    COLOR_ID_ELECTRIC_PURPLE,
+    COLOR_ID_ELECTRIC_ULTRAMARINE,
+    COLOR_ID_ELECTRIC_VIOLET,
+    COLOR_ID_ELECTRIC_YELLOW,
+    COLOR_ID_EMERALD,
+    COLOR_ID_ENGLISH_LAVENDER,
+    COLOR_ID_ETON_BLUE,
+    COLOR_ID_FALLOW,
+    COLOR_ID_FALU_RED,
+    COLOR_ID_FANDANGO,
+    COLOR_ID_FASHION_FUCHSIA,
+    COLOR_ID_FAWN,
+    COLOR_ID_FELDGRAU,
+    COLOR_ID_FERN_GREEN,
+    COLOR_ID_FERRARI_RED,
+    COLOR_ID_FIELD_DRAB,
+    COLOR_ID_FIRE_ENGINE_RED,
+    COLOR_ID_FIREBRICK,
+    COLOR_ID_FLAME,
+    COLOR_ID_FLAMINGO_PINK,
+    COLOR_ID_FLAVESCENT,
+    COLOR_ID_FLAX,
+    COLOR_ID_FLORAL_WHITE,
+    COLOR_ID_FLUORESCENT_ORANGE,
+    COLOR_ID_FLUORESCENT_PINK,
+    COLOR_ID_FLUORESCENT_YELLOW,
+    COLOR_ID_FOLLY,
+    COLOR_ID_FOREST_GREEN_TRADITIONAL,
+    COLOR_ID_FOREST_GREEN_WEB,
+    COLOR_ID_FRENCH_BEIGE,
+    COLOR_ID_FRENCH_BLUE,
+    COLOR_ID_FRENCH_LILAC,
+    COLOR_ID_FRENCH_LIME,
+    COLOR_ID_FRENCH_RASPBERRY,
+    COLOR_ID_FRENCH_ROSE,
+    COLOR_ID_FUCHSIA,
+    COLOR_ID_FUCHSIA_CRAYOLA,
+    COLOR_ID_FUCHSIA_PINK,
+    COLOR_ID_FUCHSIA_ROSE,
+    COLOR_ID_FULVOUS,
+    COLOR_ID_FUZZY_WUZZY,
+    COLOR_ID_GAINSBORO,
+    COLOR_ID_GAMBOGE,
+    COLOR_ID_GHOST_WHITE,
+    COLOR_ID_GINGER,
+    COLOR_ID_GLAUCOUS,
+    COLOR_ID_GLITTER,
+    COLOR_ID_GOLD_METALLIC,
+    COLOR_ID_GOLD_WEB_GOLDEN,
+    COLOR_ID_GOLDEN_BROWN,
+    COLOR_ID_GOLDEN_POPPY,
+    COLOR_ID_GOLDEN_YELLOW,
+    COLOR_ID_GOLDENROD,
+    COLOR_ID_GRANNY_SMITH_APPLE,
+    COLOR_ID_GRAY,
+    COLOR_ID_GRAY_ASPARAGUS,
+    COLOR_ID_GRAY_HTML_CSS_GRAY,
+    COLOR_ID_GRAY_X11_GRAY,
+    COLOR_ID_GREEN_COLOR_WHEEL_X11_GREEN,
+    COLOR_ID_GREEN_CRAYOLA,
+    COLOR_ID_GREEN_HTML_CSS_GREEN,
+    COLOR_ID_GREEN_MUNSELL,
+    COLOR_ID_GREEN_NCS,
+    COLOR_ID_GREEN_PIGMENT,
+    COLOR_ID_GREEN_RYB,
+    COLOR_ID_GREEN_YELLOW,
+    COLOR_ID_GRULLO,
+    COLOR_ID_GUPPIE_GREEN,
+    COLOR_ID_HALAY_BE,
+    COLOR_ID_HAN_BLUE,
+    COLOR_ID_HAN_PURPLE,
+    COLOR_ID_HANSA_YELLOW,
+    COLOR_ID_HARLEQUIN,
+    COLOR_ID_HARVARD_CRIMSON,
+    COLOR_ID_HARVEST_GOLD,
+    COLOR_ID_HEART_GOLD,
+    COLOR_ID_HELIOTROPE,
+    COLOR_ID_HOLLYWOOD_CERISE,
+    COLOR_ID_HONEYDEW,
+    COLOR_ID_HONOLULU_BLUE,
+    COLOR_ID_HOOKER_S_GREEN,
+    COLOR_ID_HOT_MAGENTA,
+    COLOR_ID_HOT_PINK,
+    COLOR_ID_HUNTER_GREEN,
+    COLOR_ID_ICEBERG,
+    COLOR_ID_ICTERINE,
+    COLOR_ID_IMPERIAL_BLUE,
+    COLOR_ID_INCHWORM,
+    COLOR_ID_INDIA_GREEN,
+    COLOR_ID_INDIAN_RED,
+    COLOR_ID_INDIAN_YELLOW,
+    COLOR_ID_INDIGO,
+    COLOR_ID_INDIGO_DYE,
+    COLOR_ID_INDIGO_WEB,
+    COLOR_ID_INTERNATIONAL_KLEIN_BLUE,
+    COLOR_ID_INTERNATIONAL_ORANGE_AEROSPACE,
+    COLOR_ID_INTERNATIONAL_ORANGE_ENGINEERING,
+    COLOR_ID_INTERNATIONAL_ORANGE_GOLDEN_GATE_BRIDGE,
+    COLOR_ID_IRIS,
+    COLOR_ID_ISABELLINE,
+    COLOR_ID_ISLAMIC_GREEN,
+    COLOR_ID_IVORY,
+    COLOR_ID_JADE,
+    COLOR_ID_JASMINE,
+    COLOR_ID_JASPER,
+    COLOR_ID_JAZZBERRY_JAM,
+    COLOR_ID_JET,
+    COLOR_ID_JONQUIL,
+    COLOR_ID_JUNE_BUD,
+    COLOR_ID_JUNGLE_GREEN,
+    COLOR_ID_KELLY_GREEN,
+    COLOR_ID_KENYAN_COPPER,
+    COLOR_ID_KHAKI_HTML_CSS_KHAKI,
+    COLOR_ID_KHAKI_X11_LIGHT_KHAKI,
+    COLOR_ID_KU_CRIMSON,
+    COLOR_ID_LA_SALLE_GREEN,
+    COLOR_ID_LANGUID_LAVENDER,
+    COLOR_ID_LAPIS_LAZULI,
+    COLOR_ID_LASER_LEMON,
+    COLOR_ID_LAUREL_GREEN,
+    COLOR_ID_LAVA,
+    COLOR_ID_LAVENDER_BLUE,
+    COLOR_ID_LAVENDER_BLUSH,
+    COLOR_ID_LAVENDER_FLORAL,
+    COLOR_ID_LAVENDER_GRAY,
+    COLOR_ID_LAVENDER_INDIGO,
+    COLOR_ID_LAVENDER_MAGENTA,
+    COLOR_ID_LAVENDER_MIST,
+    COLOR_ID_LAVENDER_PINK,
+    COLOR_ID_LAVENDER_PURPLE,
+    COLOR_ID_LAVENDER_ROSE,
+    COLOR_ID_LAVENDER_WEB,
+    COLOR_ID_LAWN_GREEN,
+    COLOR_ID_LEMON,
+    COLOR_ID_LEMON_CHIFFON,
+    COLOR_ID_LEMON_LIME,
+    COLOR_ID_LICORICE,
+    COLOR_ID_LIGHT_APRICOT,
+    COLOR_ID_LIGHT_BLUE,
+    COLOR_ID_LIGHT_BROWN,
+    COLOR_ID_LIGHT_CARMINE_PINK,
+    COLOR_ID_LIGHT_CORAL,
+    COLOR_ID_LIGHT_CORNFLOWER_BLUE,
+    COLOR_ID_LIGHT_CRIMSON,
+    COLOR_ID_LIGHT_CYAN,
+    COLOR_ID_LIGHT_FUCHSIA_PINK,
+    COLOR_ID_LIGHT_GOLDENROD_YELLOW,
+    COLOR_ID_LIGHT_GRAY,
+    COLOR_ID_LIGHT_GREEN,
+    COLOR_ID_LIGHT_KHAKI,
+    COLOR_ID_LIGHT_PASTEL_PURPLE,
+    COLOR_ID_LIGHT_PINK,
+    COLOR_ID_LIGHT_RED_OCHRE,
+    COLOR_ID_LIGHT_SALMON,
+    COLOR_ID_LIGHT_SALMON_PINK,
+    COLOR_ID_LIGHT_SEA_GREEN,
+    COLOR_ID_LIGHT_SKY_BLUE,
+    COLOR_ID_LIGHT_SLATE_GRAY,
+    COLOR_ID_LIGHT_TAUPE,
+    COLOR_ID_LIGHT_THULIAN_PINK,
+    COLOR_ID_LIGHT_YELLOW,
+    COLOR_ID_LILAC,
+    COLOR_ID_LIME_COLOR_WHEEL,
+    COLOR_ID_LIME_GREEN,
+    COLOR_ID_LIME_WEB_X11_GREEN,
+    COLOR_ID_LIMERICK,
+    COLOR_ID_LINCOLN_GREEN,
+    COLOR_ID_LINEN,
+    COLOR_ID_LION,
+    COLOR_ID_LITTLE_BOY_BLUE,
+    COLOR_ID_LIVER,
+    COLOR_ID_LUST,
+    COLOR_ID_MAGENTA,
+    COLOR_ID_MAGENTA_DYE,
+    COLOR_ID_MAGENTA_PROCESS,
+    COLOR_ID_MAGIC_MINT,
+    COLOR_ID_MAGNOLIA,
+    COLOR_ID_MAHOGANY,
+    COLOR_ID_MAIZE,
+    COLOR_ID_MAJORELLE_BLUE,
+    COLOR_ID_MALACHITE,
+    COLOR_ID_MANATEE,
+    COLOR_ID_MANGO_TANGO,
+    COLOR_ID_MANTIS,
+    COLOR_ID_MARDI_GRAS,
+    COLOR_ID_MAROON_CRAYOLA,
+    COLOR_ID_MAROON_HTML_CSS,
+    COLOR_ID_MAROON_X11,
+    COLOR_ID_MAUVE,
+    COLOR_ID_MAUVE_TAUPE,
+    COLOR_ID_MAUVELOUS,
+    COLOR_ID_MAYA_BLUE,
+    COLOR_ID_MEAT_BROWN,
+    COLOR_ID_MEDIUM_AQUAMARINE,
+    COLOR_ID_MEDIUM_BLUE,
+    COLOR_ID_MEDIUM_CANDY_APPLE_RED,
+    COLOR_ID_MEDIUM_CARMINE,
+    COLOR_ID_MEDIUM_CHAMPAGNE,
+    COLOR_ID_MEDIUM_ELECTRIC_BLUE,
+    COLOR_ID_MEDIUM_JUNGLE_GREEN,
+    COLOR_ID_MEDIUM_LAVENDER_MAGENTA,
+    COLOR_ID_MEDIUM_ORCHID,
+    COLOR_ID_MEDIUM_PERSIAN_BLUE,
+    COLOR_ID_MEDIUM_PURPLE,
+    COLOR_ID_MEDIUM_RED_VIOLET,
+    COLOR_ID_MEDIUM_RUBY,
+    COLOR_ID_MEDIUM_SEA_GREEN,
+    COLOR_ID_MEDIUM_SLATE_BLUE,
+    COLOR_ID_MEDIUM_SPRING_BUD,
+    COLOR_ID_MEDIUM_SPRING_GREEN,
+    COLOR_ID_MEDIUM_TAUPE,
+    COLOR_ID_MEDIUM_TURQUOISE,
+    COLOR_ID_MEDIUM_TUSCAN_RED,
+    COLOR_ID_MEDIUM_VERMILION,
+    COLOR_ID_MEDIUM_VIOLET_RED,
+    COLOR_ID_MELLOW_APRICOT,
+    COLOR_ID_MELLOW_YELLOW,
+    COLOR_ID_MELON,
+    COLOR_ID_MIDNIGHT_BLUE,
+    COLOR_ID_MIDNIGHT_GREEN_EAGLE_GREEN,
+    COLOR_ID_MIKADO_YELLOW,
+    COLOR_ID_MINT,
+    COLOR_ID_MINT_CREAM,
+    COLOR_ID_MINT_GREEN,
+    COLOR_ID_MISTY_ROSE,
+    COLOR_ID_MOCCASIN,
+    COLOR_ID_MODE_BEIGE,
+    COLOR_ID_MOONSTONE_BLUE,
+    COLOR_ID_MORDANT_RED_19,
+    COLOR_ID_MOSS_GREEN,
+    COLOR_ID_MOUNTAIN_MEADOW,
+    COLOR_ID_MOUNTBATTEN_PINK,
+    COLOR_ID_MSU_GREEN,
+    COLOR_ID_MULBERRY,
+    COLOR_ID_MUSTARD,
+    COLOR_ID_MYRTLE,
+    COLOR_ID_NADESHIKO_PINK,
+    COLOR_ID_NAPIER_GREEN,
+    COLOR_ID_NAPLES_YELLOW,
+    COLOR_ID_NAVAJO_WHITE,
+    COLOR_ID_NAVY_BLUE,
+    COLOR_ID_NEON_CARROT,
+    COLOR_ID_NEON_FUCHSIA,
+    COLOR_ID_NEON_GREEN,
+    COLOR_ID_NEW_YORK_PINK,
+    COLOR_ID_NON_PHOTO_BLUE,
+    COLOR_ID_NORTH_TEXAS_GREEN,
+    COLOR_ID_OCEAN_BOAT_BLUE,
+    COLOR_ID_OCHRE,
+    COLOR_ID_OFFICE_GREEN,
+    COLOR_ID_OLD_GOLD,
+    COLOR_ID_OLD_LACE,
+    COLOR_ID_OLD_LAVENDER,
+    COLOR_ID_OLD_MAUVE,
+    COLOR_ID_OLD_ROSE,
+    COLOR_ID_OLIVE,
+    COLOR_ID_OLIVE_DRAB_7,
+    COLOR_ID_OLIVE_DRAB_WEB_OLIVE_DRAB_3,
+    COLOR_ID_OLIVINE,
+    COLOR_ID_ONYX,
+    COLOR_ID_OPERA_MAUVE,
+    COLOR_ID_ORANGE_COLOR_WHEEL,
+    COLOR_ID_ORANGE_PEEL,
+    COLOR_ID_ORANGE_RED,
+    COLOR_ID_ORANGE_RYB,
+    COLOR_ID_ORANGE_WEB_COLOR,
+    COLOR_ID_ORCHID,
+    COLOR_ID_OTTER_BROWN,
+    COLOR_ID_OU_CRIMSON_RED,
+    COLOR_ID_OUTER_SPACE,
+    COLOR_ID_OUTRAGEOUS_ORANGE,
+    COLOR_ID_OXFORD_BLUE,
+    COLOR_ID_PAKISTAN_GREEN,
+    COLOR_ID_PALATINATE_BLUE,
+    COLOR_ID_PALATINATE_PURPLE,
+    COLOR_ID_PALE_AQUA,
+    COLOR_ID_PALE_BLUE,
+    COLOR_ID_PALE_BROWN,
+    COLOR_ID_PALE_CARMINE,
+    COLOR_ID_PALE_CERULEAN,
+    COLOR_ID_PALE_CHESTNUT,
+    COLOR_ID_PALE_COPPER,
+    COLOR_ID_PALE_CORNFLOWER_BLUE,
+    COLOR_ID_PALE_GOLD,
+    COLOR_ID_PALE_GOLDENROD,
+    COLOR_ID_PALE_GREEN,
+    COLOR_ID_PALE_LAVENDER,
+    COLOR_ID_PALE_MAGENTA,
+    COLOR_ID_PALE_PINK,
+    COLOR_ID_PALE_PLUM,
+    COLOR_ID_PALE_RED_VIOLET,
+    COLOR_ID_PALE_ROBIN_EGG_BLUE,
+    COLOR_ID_PALE_SILVER,
+    COLOR_ID_PALE_SPRING_BUD,
+    COLOR_ID_PALE_TAUPE,
+    COLOR_ID_PALE_VIOLET_RED,
+    COLOR_ID_PANSY_PURPLE,
+    COLOR_ID_PAPAYA_WHIP,
+    COLOR_ID_PARIS_GREEN,
+    COLOR_ID_PASTEL_BLUE,
+    COLOR_ID_PASTEL_BROWN,
+    COLOR_ID_PASTEL_GRAY,
+    COLOR_ID_PASTEL_GREEN,
+    COLOR_ID_PASTEL_MAGENTA,
+    COLOR_ID_PASTEL_ORANGE,
+    COLOR_ID_PASTEL_PINK,
+    COLOR_ID_PASTEL_PURPLE,
+    COLOR_ID_PASTEL_RED,
+    COLOR_ID_PASTEL_VIOLET,
+    COLOR_ID_PASTEL_YELLOW,
+    COLOR_ID_PATRIARCH,
+    COLOR_ID_PAYNE_S_GREY,
+    COLOR_ID_PEACH,
+    COLOR_ID_PEACH_CRAYOLA,
+    COLOR_ID_PEACH_ORANGE,
+    COLOR_ID_PEACH_PUFF,
+    COLOR_ID_PEACH_YELLOW,
+    COLOR_ID_PEAR,
+    COLOR_ID_PEARL,
+    COLOR_ID_PEARL_AQUA,
+    COLOR_ID_PEARLY_PURPLE,
+    COLOR_ID_PERIDOT,
+    COLOR_ID_PERIWINKLE,
+    COLOR_ID_PERSIAN_BLUE,
+    COLOR_ID_PERSIAN_GREEN,
+    COLOR_ID_PERSIAN_INDIGO,
+    COLOR_ID_PERSIAN_ORANGE,
+    COLOR_ID_PERSIAN_PINK,
+    COLOR_ID_PERSIAN_PLUM,
+    COLOR_ID_PERSIAN_RED,
+    COLOR_ID_PERSIAN_ROSE,
+    COLOR_ID_PERSIMMON,
+    COLOR_ID_PERU,
+    COLOR_ID_PHLOX,
+    COLOR_ID_PHTHALO_BLUE,
+    COLOR_ID_PHTHALO_GREEN,
+    COLOR_ID_PIGGY_PINK,
+    COLOR_ID_PINE_GREEN,
+    COLOR_ID_PINK,
+    COLOR_ID_PINK_LACE,
+    COLOR_ID_PINK_ORANGE,
+    COLOR_ID_PINK_PEARL,
+    COLOR_ID_PINK_SHERBET,
+    COLOR_ID_PISTACHIO,
+    COLOR_ID_PLATINUM,
+    COLOR_ID_PLUM_TRADITIONAL,
+    COLOR_ID_PLUM_WEB,
+    COLOR_ID_PORTLAND_ORANGE,
+    COLOR_ID_POWDER_BLUE_WEB,
+    COLOR_ID_PRINCETON_ORANGE,
+    COLOR_ID_PRUNE,
+    COLOR_ID_PRUSSIAN_BLUE,
+    COLOR_ID_PSYCHEDELIC_PURPLE,
+    COLOR_ID_PUCE,
+    COLOR_ID_PUMPKIN,
+    COLOR_ID_PURPLE_HEART,
+    COLOR_ID_PURPLE_HTML_CSS,
+    COLOR_ID_PURPLE_MOUNTAIN_MAJESTY,
+    COLOR_ID_PURPLE_MUNSELL,
+    COLOR_ID_PURPLE_PIZZAZZ,
+    COLOR_ID_PURPLE_TAUPE,
+    COLOR_ID_PURPLE_X11,
+    COLOR_ID_QUARTZ,
+    COLOR_ID_RACKLEY,
+    COLOR_ID_RADICAL_RED,
+    COLOR_ID_RAJAH,
+    COLOR_ID_RASPBERRY,
+    COLOR_ID_RASPBERRY_GLACE,
+    COLOR_ID_RASPBERRY_PINK,
+    COLOR_ID_RASPBERRY_ROSE,
+    COLOR_ID_RAW_UMBER,
+    COLOR_ID_RAZZLE_DAZZLE_ROSE,
+    COLOR_ID_RAZZMATAZZ,
+    COLOR_ID_RED,
+    COLOR_ID_RED_BROWN,
+    COLOR_ID_RED_DEVIL,
+    COLOR_ID_RED_MUNSELL,
+    COLOR_ID_RED_NCS,
+    COLOR_ID_RED_ORANGE,
+    COLOR_ID_RED_PIGMENT,
+    COLOR_ID_RED_RYB,
+    COLOR_ID_RED_VIOLET,
+    COLOR_ID_REDWOOD,
+    COLOR_ID_REGALIA,
+    COLOR_ID_RESOLUTION_BLUE,
+    COLOR_ID_RICH_BLACK,
+    COLOR_ID_RICH_BRILLIANT_LAVENDER,
+    COLOR_ID_RICH_CARMINE,
+    COLOR_ID_RICH_ELECTRIC_BLUE,
+    COLOR_ID_RICH_LAVENDER,
+    COLOR_ID_RICH_LILAC,
+    COLOR_ID_RICH_MAROON,
+    COLOR_ID_RIFLE_GREEN,
+    COLOR_ID_ROBIN_EGG_BLUE,
+    COLOR_ID_ROSE,
+    COLOR_ID_ROSE_BONBON,
+    COLOR_ID_ROSE_EBONY,
+    COLOR_ID_ROSE_GOLD,
+    COLOR_ID_ROSE_MADDER,
+    COLOR_ID_ROSE_PINK,
+    COLOR_ID_ROSE_QUARTZ,
+    COLOR_ID_ROSE_TAUPE,
+    COLOR_ID_ROSE_VALE,
+    COLOR_ID_ROSEWOOD,
+    COLOR_ID_ROSSO_CORSA,
+    COLOR_ID_ROSY_BROWN,
+    COLOR_ID_ROYAL_AZURE,
+    COLOR_ID_ROYAL_BLUE_TRADITIONAL,
+    COLOR_ID_ROYAL_BLUE_WEB,
+    COLOR_ID_ROYAL_FUCHSIA,
+    COLOR_ID_ROYAL_PURPLE,
+    COLOR_ID_ROYAL_YELLOW,
+    COLOR_ID_RUBINE_RED,
+    COLOR_ID_RUBY,
+    COLOR_ID_RUBY_RED,
+    COLOR_ID_RUDDY,
+    COLOR_ID_RUDDY_BROWN,
+    COLOR_ID_RUDDY_PINK,
+    COLOR_ID_RUFOUS,
+    COLOR_ID_RUSSET,
+    COLOR_ID_RUST,
+    COLOR_ID_RUSTY_RED,
+    COLOR_ID_SACRAMENTO_STATE_GREEN,
+    COLOR_ID_SADDLE_BROWN,
+    COLOR_ID_SAFETY_ORANGE_BLAZE_ORANGE,
+    COLOR_ID_SAFFRON,
+    COLOR_ID_SALMON,
+    COLOR_ID_SALMON_PINK,
+    COLOR_ID_SAND,
+    COLOR_ID_SAND_DUNE,
+    COLOR_ID_SANDSTORM,
+    COLOR_ID_SANDY_BROWN,
+    COLOR_ID_SANDY_TAUPE,
+    COLOR_ID_SANGRIA,
+    COLOR_ID_SAP_GREEN,
+    COLOR_ID_SAPPHIRE,
+    COLOR_ID_SAPPHIRE_BLUE,
+    COLOR_ID_SATIN_SHEEN_GOLD,
+    COLOR_ID_SCARLET,
+    COLOR_ID_SCARLET_CRAYOLA,
+    COLOR_ID_SCHOOL_BUS_YELLOW,
+    COLOR_ID_SCREAMIN_GREEN,
+    COLOR_ID_SEA_BLUE,
+    COLOR_ID_SEA_GREEN,
+    COLOR_ID_SEAL_BROWN,
+    COLOR_ID_SEASHELL,
+    COLOR_ID_SELECTIVE_YELLOW,
+    COLOR_ID_SEPIA,
+    COLOR_ID_SHADOW,
+    COLOR_ID_SHAMROCK_GREEN,
+    COLOR_ID_SHOCKING_PINK,
+    COLOR_ID_SHOCKING_PINK_CRAYOLA,
+    COLOR_ID_SIENNA,
+    COLOR_ID_SILVER,
+    COLOR_ID_SINOPIA,
+    COLOR_ID_SKOBELOFF,
+    COLOR_ID_SKY_BLUE,
+    COLOR_ID_SKY_MAGENTA,
+    COLOR_ID_SLATE_BLUE,
+    COLOR_ID_SLATE_GRAY,
+    COLOR_ID_SMALT_DARK_POWDER_BLUE,
+    COLOR_ID_SMOKEY_TOPAZ,
+    COLOR_ID_SMOKY_BLACK,
+    COLOR_ID_SNOW,
+    COLOR_ID_SPIRO_DISCO_BALL,
+    COLOR_ID_SPRING_BUD,
+    COLOR_ID_SPRING_GREEN,
+    COLOR_ID_ST_PATRICK_S_BLUE,
+    COLOR_ID_STEEL_BLUE,
+    COLOR_ID_STIL_DE_GRAIN_YELLOW,
+    COLOR_ID_STIZZA,
+    COLOR_ID_STORMCLOUD,
+    COLOR_ID_STRAW,
+    COLOR_ID_SUNGLOW,
+    COLOR_ID_SUNSET,
+    COLOR_ID_TAN,
+    COLOR_ID_TANGELO,
+    COLOR_ID_TANGERINE,
+    COLOR_ID_TANGERINE_YELLOW,
+    COLOR_ID_TANGO_PINK,
+    COLOR_ID_TAUPE,
+    COLOR_ID_TAUPE_GRAY,
+    COLOR_ID_TEA_GREEN,
+    COLOR_ID_TEA_ROSE_ORANGE,
+    COLOR_ID_TEA_ROSE_ROSE,
+    COLOR_ID_TEAL,
+    COLOR_ID_TEAL_BLUE,
+    COLOR_ID_TEAL_GREEN,
+    COLOR_ID_TELEMAGENTA,
+    COLOR_ID_TENN_TAWNY,
+    COLOR_ID_TERRA_COTTA,
+    COLOR_ID_THISTLE,
+    COLOR_ID_THULIAN_PINK,
+    COLOR_ID_TICKLE_ME_PINK,
+    COLOR_ID_TIFFANY_BLUE,
+    COLOR_ID_TIGER_S_EYE,
+    COLOR_ID_TIMBERWOLF,
+    COLOR_ID_TITANIUM_YELLOW,
+    COLOR_ID_TOMATO,
+    COLOR_ID_TOOLBOX,
+    COLOR_ID_TOPAZ,
+    COLOR_ID_TRACTOR_RED,
+    COLOR_ID_TROLLEY_GREY,
+    COLOR_ID_TROPICAL_RAIN_FOREST,
+    COLOR_ID_TRUE_BLUE,
+    COLOR_ID_TUFTS_BLUE,
+    COLOR_ID_TUMBLEWEED,
+    COLOR_ID_TURKISH_ROSE,
+    COLOR_ID_TURQUOISE,
+    COLOR_ID_TURQUOISE_BLUE,
+    COLOR_ID_TURQUOISE_GREEN,
+    COLOR_ID_TUSCAN_RED,
+    COLOR_ID_TWILIGHT_LAVENDER,
+    COLOR_ID_TYRIAN_PURPLE,
+    COLOR_ID_UA_BLUE,
+    COLOR_ID_UA_RED,
+    COLOR_ID_UBE,
+    COLOR_ID_UCLA_BLUE,
+    COLOR_ID_UCLA_GOLD,
+    COLOR_ID_UFO_GREEN,
+    COLOR_ID_ULTRA_PINK,
+    COLOR_ID_ULTRAMARINE,
+    COLOR_ID_ULTRAMARINE_BLUE,
+    COLOR_ID_UMBER,
+    COLOR_ID_UNBLEACHED_SILK,
+    COLOR_ID_UNITED_NATIONS_BLUE,
+    COLOR_ID_UNIVERSITY_OF_CALIFORNIA_GOLD,
+    COLOR_ID_UNMELLOW_YELLOW,
+    COLOR_ID_UP_FOREST_GREEN,
+    COLOR_ID_UP_MAROON,
+    COLOR_ID_UPSDELL_RED,
+    COLOR_ID_UROBILIN,
+    COLOR_ID_USAFA_BLUE,
+    COLOR_ID_USC_CARDINAL,
+    COLOR_ID_USC_GOLD,
+    COLOR_ID_UTAH_CRIMSON,
+    COLOR_ID_VANILLA,
+    COLOR_ID_VEGAS_GOLD,
+    COLOR_ID_VENETIAN_RED,
+    COLOR_ID_VERDIGRIS,
+    COLOR_ID_VERMILION_CINNABAR,
+    COLOR_ID_VERMILION_PLOCHERE,
+    COLOR_ID_VERONICA,
+    COLOR_ID_VIOLET,
+    COLOR_ID_VIOLET_BLUE,
+    COLOR_ID_VIOLET_COLOR_WHEEL,
+    COLOR_ID_VIOLET_RYB,
+    COLOR_ID_VIOLET_WEB,
+    COLOR_ID_VIRIDIAN,
+    COLOR_ID_VIVID_AUBURN,
+    COLOR_ID_VIVID_BURGUNDY,
+    COLOR_ID_VIVID_CERISE,
+    COLOR_ID_VIVID_TANGERINE,
+    COLOR_ID_VIVID_VIOLET,
+    COLOR_ID_WARM_BLACK,
+    COLOR_ID_WATERSPOUT,
+    COLOR_ID_WENGE,
+    COLOR_ID_WHEAT,
+    COLOR_ID_WHITE,
+    COLOR_ID_WHITE_SMOKE,
+    COLOR_ID_WILD_BLUE_YONDER,
+    COLOR_ID_WILD_STRAWBERRY,
+    COLOR_ID_WILD_WATERMELON,
+    COLOR_ID_WINE,
+    COLOR_ID_WINE_DREGS,
+    COLOR_ID_WISTERIA,
+    COLOR_ID_WOOD_BROWN,
+    COLOR_ID_XANADU,
+    COLOR_ID_YALE_BLUE,
+    COLOR_ID_YELLOW,
+    COLOR_ID_YELLOW_GREEN,
+    COLOR_ID_YELLOW_MUNSELL,
+    COLOR_ID_YELLOW_NCS,
+    COLOR_ID_YELLOW_ORANGE,
+    COLOR_ID_YELLOW_PROCESS,
+    COLOR_ID_YELLOW_RYB,
+    COLOR_ID_ZAFFRE,
+    COLOR_ID_ZINNWALDITE_BROWN,
+} ColorId;
+
+#endif
\ No newline at end of file
@@ -0,0 +1,1244 @@
+#ifndef COLORS_TABLE_H_
+#define COLORS_TABLE_H_
+
+// Generated by def_colors.py from colors.json, include only from color_names.cpp
+
+#define COLOR_NAMES_SLOTS 1024
+#define COLOR_NAMES_BUCKETS 256
+
+static const char COLOR_NAME_0[] PROGMEM = "air_force_blue_raf";
+static const char COLOR_NAME_1[] PROGMEM = "air_force_blue_usaf";
+static const char COLOR_NAME_2[] PROGMEM = "air_superiority_blue";
+static const char COLOR_NAME_3[] PROGMEM = "alabama_crimson";
+static const char COLOR_NAME_4[] PROGMEM = "alice_blue";
+static const char COLOR_NAME_5[] PROGMEM = "alizarin_crimson";
+static const char COLOR_NAME_6[] PROGMEM = "alloy_orange";
+static const char COLOR_NAME_7[] PROGMEM = "almond";
+static const char COLOR_NAME_8[] PROGMEM = "amaranth";
+static const char COLOR_NAME_9[] PROGMEM = "amber";
+static const char COLOR_NAME_10[] PROGMEM = "amber_sae_ece";
+static const char COLOR_NAME_11[] PROGMEM = "american_rose";
+static const char COLOR_NAME_12[] PROGMEM = "amethyst";
+static const char COLOR_NAME_13[] PROGMEM = "android_green";
+static const char COLOR_NAME_14[] PROGMEM = "anti_flash_white";
+static const char COLOR_NAME_15[] PROGMEM = "antique_brass";
+static const char COLOR_NAME_16[] PROGMEM = "antique_fuchsia";
+static const char COLOR_NAME_17[] PROGMEM = "antique_ruby";
+static const char COLOR_NAME_18[] PROGMEM = "antique_white";
+static const char COLOR_NAME_19[] PROGMEM = "ao_english";
+static const char COLOR_NAME_20[] PROGMEM = "apple_green";
+static const char COLOR_NAME_21[] PROGMEM = "apricot";
+static const char COLOR_NAME_22[] PROGMEM = "aqua";
+static const char COLOR_NAME_23[] PROGMEM = "aquamarine";
+static const char COLOR_NAME_24[] PROGMEM = "army_green";
+static const char COLOR_NAME_25[] PROGMEM = "arsenic";
+static const char COLOR_NAME_26[] PROGMEM = "arylide_yellow";
+static const char COLOR_NAME_27[] PROGMEM = "ash_grey";
+static const char COLOR_NAME_28[] PROGMEM = "asparagus";
+static const char COLOR_NAME_29[] PROGMEM = "atomic_tangerine";
+static const char COLOR_NAME_30[] PROGMEM = "auburn";
+static const char COLOR_NAME_31[] PROGMEM = "aureolin";
+static const char COLOR_NAME_32[] PROGMEM = "aurometalsaurus";
+static const char COLOR_NAME_33[] PROGMEM = "avocado";
+static const char COLOR_NAME_34[] PROGMEM = "azure";
+static const char COLOR_NAME_35[] PROGMEM = "azure_mist_web";
+static const char COLOR_NAME_36[] PROGMEM = "baby_blue";
+static const char COLOR_NAME_37[] PROGMEM = "baby_blue_eyes";
+static const char COLOR_NAME_38[] PROGMEM = "baby_pink";
+static const char COLOR_NAME_39[] PROGMEM = "ball_blue";
+static const char COLOR_NAME_40[] PROGMEM = "banana_mania";
+static const char COLOR_NAME_41[] PROGMEM = "banana_yellow";
+static const char COLOR_NAME_42[] PROGMEM = "barn_red";
+static const char COLOR_NAME_43[] PROGMEM = "battleship_grey";
+static const char COLOR_NAME_44[] PROGMEM = "bazaar";
+static const char COLOR_NAME_45[] PROGMEM = "beau_blue";
+static const char COLOR_NAME_46[] PROGMEM = "beaver";
+static const char COLOR_NAME_47[] PROGMEM = "beige";
+static const char COLOR_NAME_48[] PROGMEM = "big_dip_o_ruby";
+static const char COLOR_NAME_49[] PROGMEM = "bisque";
+static const char COLOR_NAME_50[] PROGMEM = "bistre";
+static const char COLOR_NAME_51[] PROGMEM = "bittersweet";
+static const char COLOR_NAME_52[] PROGMEM = "bittersweet_shimmer";
+static const char COLOR_NAME_53[] PROGMEM = "black";
+static const char COLOR_NAME_54[] PROGMEM = "black_bean";
+static const char COLOR_NAME_55[] PROGMEM = "black_leather_jacket";
+static const char COLOR_NAME_56[] PROGMEM = "black_olive";
+static const char COLOR_NAME_57[] PROGMEM = "blanched_almond";
+static const char COLOR_NAME_58[] PROGMEM = "blast_off_bronze";
+static const char COLOR_NAME_59[] PROGMEM = "bleu_de_france";
+static const char COLOR_NAME_60[] PROGMEM = "blizzard_blue";
+static const char COLOR_NAME_61[] PROGMEM = "blond";
+static const char COLOR_NAME_62[] PROGMEM = "blue";
+static const char COLOR_NAME_63[] PROGMEM = "blue_bell";
+static const char COLOR_NAME_64[] PROGMEM = "blue_crayola";
+static const char COLOR_NAME_65[] PROGMEM = "blue_gray";
+static const char COLOR_NAME_66[] PROGMEM = "blue_green";
+static const char COLOR_NAME_67[] PROGMEM = "blue_munsell";
+static const char COLOR_NAME_68[] PROGMEM = "blue_ncs";
+static const char COLOR_NAME_69[] PROGMEM = "blue_pigment";
+static const char COLOR_NAME_70[] PROGMEM = "blue_ryb";
+static const char COLOR_NAME_71[] PROGMEM = "blue_sapphire";
+static const char COLOR_NAME_72[] PROGMEM = "blue_violet";
+static const char COLOR_NAME_73[] PROGMEM = "blush";
+static const char COLOR_NAME_74[] PROGMEM = "bole";
+static const char COLOR_NAME_75[] PROGMEM = "bondi_blue";
+static const char COLOR_NAME_76[] PROGMEM = "bone";
+static const char COLOR_NAME_77[] PROGMEM = "boston_university_red";
+static const char COLOR_NAME_78[] PROGMEM = "bottle_green";
+static const char COLOR_NAME_79[] PROGMEM = "boysenberry";
+static const char COLOR_NAME_80[] PROGMEM = "brandeis_blue";
+static const char COLOR_NAME_81[] PROGMEM = "brass";
+static const char COLOR_NAME_82[] PROGMEM = "brick_red";
+static const char COLOR_NAME_83[] PROGMEM = "bright_cerulean";
+static const char COLOR_NAME_84[] PROGMEM = "bright_green";
+static const char COLOR_NAME_85[] PROGMEM = "bright_lavender";
+static const char COLOR_NAME_86[] PROGMEM = "bright_maroon";
+static const char COLOR_NAME_87[] PROGMEM = "bright_pink";
+static const char COLOR_NAME_88[] PROGMEM = "bright_turquoise";
+static const char COLOR_NAME_89[] PROGMEM = "bright_ube";
+static const char COLOR_NAME_90[] PROGMEM = "brilliant_lavender";
+static const char COLOR_NAME_91[] PROGMEM = "brilliant_rose";
+static const char COLOR_NAME_92[] PROGMEM = "brink_pink";
+static const char COLOR_NAME_93[] PROGMEM = "british_racing_green";
+static const char COLOR_NAME_94[] PROGMEM = "bronze";
+static const char COLOR_NAME_95[] PROGMEM = "brown_traditional";
+static const char COLOR_NAME_96[] PROGMEM = "brown_web";
+static const char COLOR_NAME_97[] PROGMEM = "bubble_gum";
+static const char COLOR_NAME_98[] PROGMEM = "bubbles";
+static const char COLOR_NAME_99[] PROGMEM = "buff";
+static const char COLOR_NAME_100[] PROGMEM = "bulgarian_rose";
+static const char COLOR_NAME_101[] PROGMEM = "burgundy";
+static const char COLOR_NAME_102[] PROGMEM = "burlywood";
+static const char COLOR_NAME_103[] PROGMEM = "burnt_orange";
+static const char COLOR_NAME_104[] PROGMEM = "burnt_sienna";
+static const char COLOR_NAME_105[] PROGMEM = "burnt_umber";
+static const char COLOR_NAME_106[] PROGMEM = "byzantine";
+static const char COLOR_NAME_107[] PROGMEM = "byzantium";
+static const char COLOR_NAME_108[] PROGMEM = "cadet";
+static const char COLOR_NAME_109[] PROGMEM = "cadet_blue";
+static const char COLOR_NAME_110[] PROGMEM = "cadet_grey";
+static const char COLOR_NAME_111[] PROGMEM = "cadmium_green";
+static const char COLOR_NAME_112[] PROGMEM = "cadmium_orange";
+static const char COLOR_NAME_113[] PROGMEM = "cadmium_red";
+static const char COLOR_NAME_114[] PROGMEM = "cadmium_yellow";
+static const char COLOR_NAME_115[] PROGMEM = "caf_au_lait";
+static const char COLOR_NAME_116[] PROGMEM = "caf_noir";
+static const char COLOR_NAME_117[] PROGMEM = "cal_poly_green";
+static const char COLOR_NAME_118[] PROGMEM = "cambridge_blue";
+static const char COLOR_NAME_119[] PROGMEM = "camel";
+static const char COLOR_NAME_120[] PROGMEM = "cameo_pink";
+static const char COLOR_NAME_121[] PROGMEM = "camouflage_green";
+static const char COLOR_NAME_122[] PROGMEM = "canary_yellow";
+static const char COLOR_NAME_123[] PROGMEM = "candy_apple_red";
+static const char COLOR_NAME_124[] PROGMEM = "candy_pink";
+static const char COLOR_NAME_125[] PROGMEM = "capri";
+static const char COLOR_NAME_126[] PROGMEM = "caput_mortuum";
+static const char COLOR_NAME_127[] PROGMEM = "cardinal";
+static const char COLOR_NAME_128[] PROGMEM = "caribbean_green";
+static const char COLOR_NAME_129[] PROGMEM = "carmine";
+static const char COLOR_NAME_130[] PROGMEM = "carmine_m_p";
+static const char COLOR_NAME_131[] PROGMEM = "carmine_pink";
+static const char COLOR_NAME_132[] PROGMEM = "carmine_red";
+static const char COLOR_NAME_133[] PROGMEM = "carnation_pink";
+static const char COLOR_NAME_134[] PROGMEM = "carnelian";
+static const char COLOR_NAME_135[] PROGMEM = "carolina_blue";
+static const char COLOR_NAME_136[] PROGMEM = "carrot_orange";
+static const char COLOR_NAME_137[] PROGMEM = "catalina_blue";
+static const char COLOR_NAME_138[] PROGMEM = "ceil";
+static const char COLOR_NAME_139[] PROGMEM = "celadon";
+static const char COLOR_NAME_140[] PROGMEM = "celadon_blue";
+static const char COLOR_NAME_141[] PROGMEM = "celadon_green";
+static const char COLOR_NAME_142[] PROGMEM = "celeste_colour";
+static const char COLOR_NAME_143[] PROGMEM = "celestial_blue";
+static const char COLOR_NAME_144[] PROGMEM = "cerise";
+static const char COLOR_NAME_145[] PROGMEM = "cerise_pink";
+static const char COLOR_NAME_146[] PROGMEM = "cerulean";
+static const char COLOR_NAME_147[] PROGMEM = "cerulean_blue";
+static const char COLOR_NAME_148[] PROGMEM = "cerulean_frost";
+static const char COLOR_NAME_149[] PROGMEM = "cg_blue";
+static const char COLOR_NAME_150[] PROGMEM = "cg_red";
+static const char COLOR_NAME_151[] PROGMEM = "chamoisee";
+static const char COLOR_NAME_152[] PROGMEM = "champagne";
+static const char COLOR_NAME_153[] PROGMEM = "charcoal";
+static const char COLOR_NAME_154[] PROGMEM = "charm_pink";
+static const char COLOR_NAME_155[] PROGMEM = "chartreuse_traditional";
+static const char COLOR_NAME_156[] PROGMEM = "chartreuse_web";
+static const char COLOR_NAME_157[] PROGMEM = "cherry";
+static const char COLOR_NAME_158[] PROGMEM = "cherry_blossom_pink";
+static const char COLOR_NAME_159[] PROGMEM = "chestnut";
+static const char COLOR_NAME_160[] PROGMEM = "china_pink";
+static const char COLOR_NAME_161[] PROGMEM = "china_rose";
+static const char COLOR_NAME_162[] PROGMEM = "chinese_red";
+static const char COLOR_NAME_163[] PROGMEM = "chocolate_traditional";
+static const char COLOR_NAME_164[] PROGMEM = "chocolate_web";
+static const char COLOR_NAME_165[] PROGMEM = "chrome_yellow";
+static const char COLOR_NAME_166[] PROGMEM = "cinereous";
+static const char COLOR_NAME_167[] PROGMEM = "cinnabar";
+static const char COLOR_NAME_168[] PROGMEM = "cinnamon";
+static const char COLOR_NAME_169[] PROGMEM = "citrine";
+static const char COLOR_NAME_170[] PROGMEM = "classic_rose";
+static const char COLOR_NAME_171[] PROGMEM = "cobalt";
+static const char COLOR_NAME_172[] PROGMEM = "cocoa_brown";
+static const char COLOR_NAME_173[] PROGMEM = "coffee";
+static const char COLOR_NAME_174[] PROGMEM = "columbia_blue";
+static const char COLOR_NAME_175[] PROGMEM = "congo_pink";
+static const char COLOR_NAME_176[] PROGMEM = "cool_black";
+static const char COLOR_NAME_177[] PROGMEM = "cool_grey";
+static const char COLOR_NAME_178[] PROGMEM = "copper";
+static const char COLOR_NAME_179[] PROGMEM = "copper_crayola";
+static const char COLOR_NAME_180[] PROGMEM = "copper_penny";
+static const char COLOR_NAME_181[] PROGMEM = "copper_red";
+static const char COLOR_NAME_182[] PROGMEM = "copper_rose";
+static const char COLOR_NAME_183[] PROGMEM = "coquelicot";
+static const char COLOR_NAME_184[] PROGMEM = "coral";
+static const char COLOR_NAME_185[] PROGMEM = "coral_pink";
+static const char COLOR_NAME_186[] PROGMEM = "coral_red";
+static const char COLOR_NAME_187[] PROGMEM = "cordovan";
+static const char COLOR_NAME_188[] PROGMEM = "corn";
+static const char COLOR_NAME_189[] PROGMEM = "cornell_red";
+static const char COLOR_NAME_190[] PROGMEM = "cornflower_blue";
+static const char COLOR_NAME_191[] PROGMEM = "cornsilk";
+static const char COLOR_NAME_192[] PROGMEM = "cosmic_latte";
+static const char COLOR_NAME_193[] PROGMEM = "cotton_candy";
+static const char COLOR_NAME_194[] PROGMEM = "cream";
+static const char COLOR_NAME_195[] PROGMEM = "crimson";
+static const char COLOR_NAME_196[] PROGMEM = "crimson_glory";
+static const char COLOR_NAME_197[] PROGMEM = "cyan";
+static const char COLOR_NAME_198[] PROGMEM = "cyan_process";
+static const char COLOR_NAME_199[] PROGMEM = "daffodil";
+static const char COLOR_NAME_200[] PROGMEM = "dandelion";
+static const char COLOR_NAME_201[] PROGMEM = "dark_blue";
+static const char COLOR_NAME_202[] PROGMEM = "dark_brown";
+static const char COLOR_NAME_203[] PROGMEM = "dark_byzantium";
+static const char COLOR_NAME_204[] PROGMEM = "dark_candy_apple_red";
+static const char COLOR_NAME_205[] PROGMEM = "dark_cerulean";
+static const char COLOR_NAME_206[] PROGMEM = "dark_chestnut";
+static const char COLOR_NAME_207[] PROGMEM = "dark_coral";
+static const char COLOR_NAME_208[] PROGMEM = "dark_cyan";
+static const char COLOR_NAME_209[] PROGMEM = "dark_electric_blue";
+static const char COLOR_NAME_210[] PROGMEM = "dark_goldenrod";
+static const char COLOR_NAME_211[] PROGMEM = "dark_gray";
+static const char COLOR_NAME_212[] PROGMEM = "dark_green";
+static const char COLOR_NAME_213[] PROGMEM = "dark_imperial_blue";
+static const char COLOR_NAME_214[] PROGMEM = "dark_jungle_green";
+static const char COLOR_NAME_215[] PROGMEM = "dark_khaki";
+static const char COLOR_NAME_216[] PROGMEM = "dark_lava";
+static const char COLOR_NAME_217[] PROGMEM = "dark_lavender";
+static const char COLOR_NAME_218[] PROGMEM = "dark_magenta";
+static const char COLOR_NAME_219[] PROGMEM = "dark_midnight_blue";
+static const char COLOR_NAME_220[] PROGMEM = "dark_olive_green";
+static const char COLOR_NAME_221[] PROGMEM = "dark_orange";
+static const char COLOR_NAME_222[] PROGMEM = "dark_orchid";
+static const char COLOR_NAME_223[] PROGMEM = "dark_pastel_blue";
+static const char COLOR_NAME_224[] PROGMEM = "dark_pastel_green";
+static const char COLOR_NAME_225[] PROGMEM = "dark_pastel_purple";
+static const char COLOR_NAME_226[] PROGMEM = "dark_pastel_red";
+static const char COLOR_NAME_227[] PROGMEM = "dark_pink";
+static const char COLOR_NAME_228[] PROGMEM = "dark_powder_blue";
+static const char COLOR_NAME_229[] PROGMEM = "dark_raspberry";
+static const char COLOR_NAME_230[] PROGMEM = "dark_red";
+static const char COLOR_NAME_231[] PROGMEM = "dark_salmon";
+static const char COLOR_NAME_232[] PROGMEM = "dark_scarlet";
+static const char COLOR_NAME_233[] PROGMEM = "dark_sea_green";
+static const char COLOR_NAME_234[] PROGMEM = "dark_sienna";
+static const char COLOR_NAME_235[] PROGMEM = "dark_slate_blue";
+static const char COLOR_NAME_236[] PROGMEM = "dark_slate_gray";
+static const char COLOR_NAME_237[] PROGMEM = "dark_spring_green";
+static const char COLOR_NAME_238[] PROGMEM = "dark_tan";
+static const char COLOR_NAME_239[] PROGMEM = "dark_tangerine";
+static const char COLOR_NAME_240[] PROGMEM = "dark_taupe";
+static const char COLOR_NAME_241[] PROGMEM = "dark_terra_cotta";
+static const char COLOR_NAME_242[] PROGMEM = "dark_turquoise";
+static const char COLOR_NAME_243[] PROGMEM = "dark_violet";
+static const char COLOR_NAME_244[] PROGMEM = "dark_yellow";
+static const char COLOR_NAME_245[] PROGMEM = "dartmouth_green";
+static const char COLOR_NAME_246[] PROGMEM = "davy_s_grey";
+static const char COLOR_NAME_247[] PROGMEM = "debian_red";
+static const char COLOR_NAME_248[] PROGMEM = "deep_carmine";
+static const char COLOR_NAME_249[] PROGMEM = "deep_carmine_pink";
+static const char COLOR_NAME_250[] PROGMEM = "deep_carrot_orange";
+static const char COLOR_NAME_251[] PROGMEM = "deep_cerise";
+static const char COLOR_NAME_252[] PROGMEM = "deep_champagne";
+static const char COLOR_NAME_253[] PROGMEM = "deep_chestnut";
+static const char COLOR_NAME_254[] PROGMEM = "deep_coffee";
+static const char COLOR_NAME_255[] PROGMEM = "deep_fuchsia";
+static const char COLOR_NAME_256[] PROGMEM = "deep_jungle_green";
+static const char COLOR_NAME_257[] PROGMEM = "deep_lilac";
+static const char COLOR_NAME_258[] PROGMEM = "deep_magenta";
+static const char COLOR_NAME_259[] PROGMEM = "deep_peach";
+static const char COLOR_NAME_260[] PROGMEM = "deep_pink";
+static const char COLOR_NAME_261[] PROGMEM = "deep_ruby";
+static const char COLOR_NAME_262[] PROGMEM = "deep_saffron";
+static const char COLOR_NAME_263[] PROGMEM = "deep_sky_blue";
+static const char COLOR_NAME_264[] PROGMEM = "deep_tuscan_red";
+static const char COLOR_NAME_265[] PROGMEM = "denim";
+static const char COLOR_NAME_266[] PROGMEM = "desert";
+static const char COLOR_NAME_267[] PROGMEM = "desert_sand";
+static const char COLOR_NAME_268[] PROGMEM = "dim_gray";
+static const char COLOR_NAME_269[] PROGMEM = "dodger_blue";
+static const char COLOR_NAME_270[] PROGMEM = "dogwood_rose";
+static const char COLOR_NAME_271[] PROGMEM = "dollar_bill";
+static const char COLOR_NAME_272[] PROGMEM = "drab";
+static const char COLOR_NAME_273[] PROGMEM = "duke_blue";
+static const char COLOR_NAME_274[] PROGMEM = "earth_yellow";
+static const char COLOR_NAME_275[] PROGMEM = "ebony";
+static const char COLOR_NAME_276[] PROGMEM = "ecru";
+static const char COLOR_NAME_277[] PROGMEM = "eggplant";
+static const char COLOR_NAME_278[] PROGMEM = "eggshell";
+static const char COLOR_NAME_279[] PROGMEM = "egyptian_blue";
+static const char COLOR_NAME_280[] PROGMEM = "electric_blue";
+static const char COLOR_NAME_281[] PROGMEM = "electric_crimson";
+static const char COLOR_NAME_282[] PROGMEM = "electric_cyan";
+static const char COLOR_NAME_283[] PROGMEM = "electric_green";
+static const char COLOR_NAME_284[] PROGMEM = "electric_indigo";
+static const char COLOR_NAME_285[] PROGMEM = "electric_lavender";
+static const char COLOR_NAME_286[] PROGMEM = "electric_lime";
+static const char COLOR_NAME_287[] PROGMEM = "electric_purple";
+static const char COLOR_NAME_288[] PROGMEM = "electric_ultramarine";
+static const char COLOR_NAME_289[] PROGMEM = "electric_violet";
+static const char COLOR_NAME_290[] PROGMEM = "electric_yellow";
+static const char COLOR_NAME_291[] PROGMEM = "emerald";
+static const char COLOR_NAME_292[] PROGMEM = "english_lavender";
+static const char COLOR_NAME_293[] PROGMEM = "eton_blue";
+static const char COLOR_NAME_294[] PROGMEM = "fallow";
+static const char COLOR_NAME_295[] PROGMEM = "falu_red";
+static const char COLOR_NAME_296[] PROGMEM = "fandango";
+static const char COLOR_NAME_297[] PROGMEM = "fashion_fuchsia";
+static const char COLOR_NAME_298[] PROGMEM = "fawn";
+static const char COLOR_NAME_299[] PROGMEM = "feldgrau";
+static const char COLOR_NAME_300[] PROGMEM = "fern_green";
+static const char COLOR_NAME_301[] PROGMEM = "ferrari_red";
+static const char COLOR_NAME_302[] PROGMEM = "field_drab";
+static const char COLOR_NAME_303[] PROGMEM = "fire_engine_red";
+static const char COLOR_NAME_304[] PROGMEM = "firebrick";
+static const char COLOR_NAME_305[] PROGMEM = "flame";
+static const char COLOR_NAME_306[] PROGMEM = "flamingo_pink";
+static const char COLOR_NAME_307[] PROGMEM = "flavescent";
+static const char COLOR_NAME_308[] PROGMEM = "flax";
+static const char COLOR_NAME_309[] PROGMEM = "floral_white";
+static const char COLOR_NAME_310[] PROGMEM = "fluorescent_orange";
+static const char COLOR_NAME_311[] PROGMEM = "fluorescent_pink";
+static const char COLOR_NAME_312[] PROGMEM = "fluorescent_yellow";
+static const char COLOR_NAME_313[] PROGMEM = "folly";
+static const char COLOR_NAME_314[] PROGMEM = "forest_green_traditional";
+static const char COLOR_NAME_315[] PROGMEM = "forest_green_web";
+static const char COLOR_NAME_316[] PROGMEM = "french_beige";
+static const char COLOR_NAME_317[] PROGMEM = "french_blue";
+static const char COLOR_NAME_318[] PROGMEM = "french_lilac";
+static const char COLOR_NAME_319[] PROGMEM = "french_lime";
+static const char COLOR_NAME_320[] PROGMEM = "french_raspberry";
+static const char COLOR_NAME_321[] PROGMEM = "french_rose";
+static const char COLOR_NAME_322[] PROGMEM = "fuchsia";
+static const char COLOR_NAME_323[] PROGMEM = "fuchsia_crayola";
+static const char COLOR_NAME_324[] PROGMEM = "fuchsia_pink";
+static const char COLOR_NAME_325[] PROGMEM = "fuchsia_rose";
+static const char COLOR_NAME_326[] PROGMEM = "fulvous";
+static const char COLOR_NAME_327[] PROGMEM = "fuzzy_wuzzy";
+static const char COLOR_NAME_328[] PROGMEM = "gainsboro";
+static const char COLOR_NAME_329[] PROGMEM = "gamboge";
+static const char COLOR_NAME_330[] PROGMEM = "ghost_white";
+static const char COLOR_NAME_331[] PROGMEM = "ginger";
+static const char COLOR_NAME_332[] PROGMEM = "glaucous";
+static const char COLOR_NAME_333[] PROGMEM = "glitter";
+static const char COLOR_NAME_334[] PROGMEM = "gold_metallic";
+static const char COLOR_NAME_335[] PROGMEM = "gold_web_golden";
+static const char COLOR_NAME_336[] PROGMEM = "golden_brown";
+static const char COLOR_NAME_337[] PROGMEM = "golden_poppy";
+static const char COLOR_NAME_338[] PROGMEM = "golden_yellow";
+static const char COLOR_NAME_339[] PROGMEM = "goldenrod";
+static const char COLOR_NAME_340[] PROGMEM = "granny_smith_apple";
+static const char COLOR_NAME_341[] PROGMEM = "gray";
+static const char COLOR_NAME_342[] PROGMEM = "gray_asparagus";
+static const char COLOR_NAME_343[] PROGMEM = "gray_html_css_gray";
+static const char COLOR_NAME_344[] PROGMEM = "gray_x11_gray";
+static const char COLOR_NAME_345[] PROGMEM = "green_color_wheel_x11_green";
+static const char COLOR_NAME_346[] PROGMEM = "green_crayola";
+static const char COLOR_NAME_347[] PROGMEM = "green_html_css_green";
+static const char COLOR_NAME_348[] PROGMEM = "green_munsell";
+static const char COLOR_NAME_349[] PROGMEM = "green_ncs";
+static const char COLOR_NAME_350[] PROGMEM = "green_pigment";
+static const char COLOR_NAME_351[] PROGMEM = "green_ryb";
+static const char COLOR_NAME_352[] PROGMEM = "green_yellow";
+static const char COLOR_NAME_353[] PROGMEM = "grullo";
+static const char COLOR_NAME_354[] PROGMEM = "guppie_green";
+static const char COLOR_NAME_355[] PROGMEM = "halay_be";
+static const char COLOR_NAME_356[] PROGMEM = "han_blue";
+static const char COLOR_NAME_357[] PROGMEM = "han_purple";
+static const char COLOR_NAME_358[] PROGMEM = "hansa_yellow";
+static const char COLOR_NAME_359[] PROGMEM = "harlequin";
+static const char COLOR_NAME_360[] PROGMEM = "harvard_crimson";
+static const char COLOR_NAME_361[] PROGMEM = "harvest_gold";
+static const char COLOR_NAME_362[] PROGMEM = "heart_gold";
+static const char COLOR_NAME_363[] PROGMEM = "heliotrope";
+static const char COLOR_NAME_364[] PROGMEM = "hollywood_cerise";
+static const char COLOR_NAME_365[] PROGMEM = "honeydew";
+static const char COLOR_NAME_366[] PROGMEM = "honolulu_blue";
+static const char COLOR_NAME_367[] PROGMEM = "hooker_s_green";
+static const char COLOR_NAME_368[] PROGMEM = "hot_magenta";
+static const char COLOR_NAME_369[] PROGMEM = "hot_pink";
+static const char COLOR_NAME_370[] PROGMEM = "hunter_green";
+static const char COLOR_NAME_371[] PROGMEM = "iceberg";
+static const char COLOR_NAME_372[] PROGMEM = "icterine";
+static const char COLOR_NAME_373[] PROGMEM = "imperial_blue";
+static const char COLOR_NAME_374[] PROGMEM = "inchworm";
+static const char COLOR_NAME_375[] PROGMEM = "india_green";
+static const char COLOR_NAME_376[] PROGMEM = "indian_red";
+static const char COLOR_NAME_377[] PROGMEM = "indian_yellow";
+static const char COLOR_NAME_378[] PROGMEM = "indigo";
+static const char COLOR_NAME_379[] PROGMEM = "indigo_dye";
+static const char COLOR_NAME_380[] PROGMEM = "indigo_web";
+static const char COLOR_NAME_381[] PROGMEM = "international_klein_blue";
+static const char COLOR_NAME_382[] PROGMEM = "international_orange_aerospace";
+static const char COLOR_NAME_383[] PROGMEM = "international_orange_engineering";
+static const char COLOR_NAME_384[] PROGMEM = "international_orange_golden_gate_bridge";
+static const char COLOR_NAME_385[] PROGMEM = "iris";
+static const char COLOR_NAME_386[] PROGMEM = "isabelline";
+static const char COLOR_NAME_387[] PROGMEM = "islamic_green";
+static const char COLOR_NAME_388[] PROGMEM = "ivory";
+static const char COLOR_NAME_389[] PROGMEM = "jade";
+static const char COLOR_NAME_390[] PROGMEM = "jasmine";
+static const char COLOR_NAME_391[] PROGMEM = "jasper";
+static const char COLOR_NAME_392[] PROGMEM = "jazzberry_jam";
+static const char COLOR_NAME_393[] PROGMEM = "jet";
+static const char COLOR_NAME_394[] PROGMEM = "jonquil";
+static const char COLOR_NAME_395[] PROGMEM = "june_bud";
+static const char COLOR_NAME_396[] PROGMEM = "jungle_green";
+static const char COLOR_NAME_397[] PROGMEM = "kelly_green";
+static const char COLOR_NAME_398[] PROGMEM = "kenyan_copper";
+static const char COLOR_NAME_399[] PROGMEM = "khaki_html_css_khaki";
+static const char COLOR_NAME_400[] PROGMEM = "khaki_x11_light_khaki";
+static const char COLOR_NAME_401[] PROGMEM = "ku_crimson";
+static const char COLOR_NAME_402[] PROGMEM = "la_salle_green";
+static const char COLOR_NAME_403[] PROGMEM = "languid_lavender";
+static const char COLOR_NAME_404[] PROGMEM = "lapis_lazuli";
+static const char COLOR_NAME_405[] PROGMEM = "laser_lemon";
+static const char COLOR_NAME_406[] PROGMEM = "laurel_green";
+static const char COLOR_NAME_407[] PROGMEM = "lava";
+static const char COLOR_NAME_408[] PROGMEM = "lavender_blue";
+static const char COLOR_NAME_409[] PROGMEM = "lavender_blush";
+static const char COLOR_NAME_410[] PROGMEM = "lavender_floral";
+static const char COLOR_NAME_411[] PROGMEM = "lavender_gray";
+static const char COLOR_NAME_412[] PROGMEM = "lavender_indigo";
+static const char COLOR_NAME_413[] PROGMEM = "lavender_magenta";
+static const char COLOR_NAME_414[] PROGMEM = "lavender_mist";
+static const char COLOR_NAME_415[] PROGMEM = "lavender_pink";
+static const char COLOR_NAME_416[] PROGMEM = "lavender_purple";
+static const char COLOR_NAME_417[] PROGMEM = "lavender_rose";
+static const char COLOR_NAME_418[] PROGMEM = "lavender_web";
+static const char COLOR_NAME_419[] PROGMEM = "lawn_green";
+static const char COLOR_NAME_420[] PROGMEM = "lemon";
+static const char COLOR_NAME_421[] PROGMEM = "lemon_chiffon";
+static const char COLOR_NAME_422[] PROGMEM = "lemon_lime";
+static const char COLOR_NAME_423[] PROGMEM = "licorice";
+static const char COLOR_NAME_424[] PROGMEM = "light_apricot";
+static const char COLOR_NAME_425[] PROGMEM = "light_blue";
+static const char COLOR_NAME_426[] PROGMEM = "light_brown";
+static const char COLOR_NAME_427[] PROGMEM = "light_carmine_pink";
+static const char COLOR_NAME_428[] PROGMEM = "light_coral";
+static const char COLOR_NAME_429[] PROGMEM = "light_cornflower_blue";
+static const char COLOR_NAME_430[] PROGMEM = "light_crimson";
+static const char COLOR_NAME_431[] PROGMEM = "light_cyan";
+static const char COLOR_NAME_432[] PROGMEM = "light_fuchsia_pink";
+static const char COLOR_NAME_433[] PROGMEM = "light_goldenrod_yellow";
+static const char COLOR_NAME_434[] PROGMEM = "light_gray";
+static const char COLOR_NAME_435[] PROGMEM = "light_green";
+static const char COLOR_NAME_436[] PROGMEM = "light_khaki";
+static const char COLOR_NAME_437[] PROGMEM = "light_pastel_purple";
+static const char COLOR_NAME_438[] PROGMEM = "light_pink";
+static const char COLOR_NAME_439[] PROGMEM = "light_red_ochre";
+static const char COLOR_NAME_440[] PROGMEM = "light_salmon";
+static const char COLOR_NAME_441[] PROGMEM = "light_salmon_pink";
+static const char COLOR_NAME_442[] PROGMEM = "light_sea_green";
+static const char COLOR_NAME_443[] PROGMEM = "light_sky_blue";
+static const char COLOR_NAME_444[] PROGMEM = "light_slate_gray";
+static const char COLOR_NAME_445[] PROGMEM = "light_taupe";
+static const char COLOR_NAME_446[] PROGMEM = "light_thulian_pink";
+static const char COLOR_NAME_447[] PROGMEM = "light_yellow";
+static const char COLOR_NAME_448[] PROGMEM = "lilac";
+static const char COLOR_NAME_449[] PROGMEM = "lime_color_wheel";
+static const char COLOR_NAME_450[] PROGMEM = "lime_green";
+static const char COLOR_NAME_451[] PROGMEM = "lime_web_x11_green";
+static const char COLOR_NAME_452[] PROGMEM = "limerick";
+static const char COLOR_NAME_453[] PROGMEM = "lincoln_green";
+static const char COLOR_NAME_454[] PROGMEM = "linen";
+static const char COLOR_NAME_455[] PROGMEM = "lion";
+static const char COLOR_NAME_456[] PROGMEM = "little_boy_blue";
+static const char COLOR_NAME_457[] PROGMEM = "liver";
+static const char COLOR_NAME_458[] PROGMEM = "lust";
+static const char COLOR_NAME_459[] PROGMEM = "magenta";
+static const char COLOR_NAME_460[] PROGMEM = "magenta_dye";
+static const char COLOR_NAME_461[] PROGMEM = "magenta_process";
+static const char COLOR_NAME_462[] PROGMEM = "magic_mint";
+static const char COLOR_NAME_463[] PROGMEM = "magnolia";
+static const char COLOR_NAME_464[] PROGMEM = "mahogany";
+static const char COLOR_NAME_465[] PROGMEM = "maize";
+static const char COLOR_NAME_466[] PROGMEM = "majorelle_blue";
+static const char COLOR_NAME_467[] PROGMEM = "malachite";
+static const char COLOR_NAME_468[] PROGMEM = "manatee";
+static const char COLOR_NAME_469[] PROGMEM = "mango_tango";
+static const char COLOR_NAME_470[] PROGMEM = "mantis";
+static const char COLOR_NAME_471[] PROGMEM = "mardi_gras";
+static const char COLOR_NAME_472[] PROGMEM = "maroon_crayola";
+static const char COLOR_NAME_473[] PROGMEM = "maroon_html_css";
+static const char COLOR_NAME_474[] PROGMEM = "maroon_x11";
+static const char COLOR_NAME_475[] PROGMEM = "mauve";
+static const char COLOR_NAME_476[] PROGMEM = "mauve_taupe";
+static const char COLOR_NAME_477[] PROGMEM = "mauvelous";
+static const char COLOR_NAME_478[] PROGMEM = "maya_blue";
+static const char COLOR_NAME_479[] PROGMEM = "meat_brown";
+static const char COLOR_NAME_480[] PROGMEM = "medium_aquamarine";
+static const char COLOR_NAME_481[] PROGMEM = "medium_blue";
+static const char COLOR_NAME_482[] PROGMEM = "medium_candy_apple_red";
+static const char COLOR_NAME_483[] PROGMEM = "medium_carmine";
+static const char COLOR_NAME_484[] PROGMEM = "medium_champagne";
+static const char COLOR_NAME_485[] PROGMEM = "medium_electric_blue";
+static const char COLOR_NAME_486[] PROGMEM = "medium_jungle_green";
+static const char COLOR_NAME_487[] PROGMEM = "medium_lavender_magenta";
+static const char COLOR_NAME_488[] PROGMEM = "medium_orchid";
+static const char COLOR_NAME_489[] PROGMEM = "medium_persian_blue";
+static const char COLOR_NAME_490[] PROGMEM = "medium_purple";
+static const char COLOR_NAME_491[] PROGMEM = "medium_red_violet";
+static const char COLOR_NAME_492[] PROGMEM = "medium_ruby";
+static const char COLOR_NAME_493[] PROGMEM = "medium_sea_green";
+static const char COLOR_NAME_494[] PROGMEM = "medium_slate_blue";
+static const char COLOR_NAME_495[] PROGMEM = "medium_spring_bud";
+static const char COLOR_NAME_496[] PROGMEM = "medium_spring_green";
+static const char COLOR_NAME_497[] PROGMEM = "medium_taupe";
+static const char COLOR_NAME_498[] PROGMEM = "medium_turquoise";
+static const char COLOR_NAME_499[] PROGMEM = "medium_tuscan_red";
+static const char COLOR_NAME_500[] PROGMEM = "medium_vermilion";
+static const char COLOR_NAME_501[] PROGMEM = "medium_violet_red";
+static const char COLOR_NAME_502[] PROGMEM = "mellow_apricot";
+static const char COLOR_NAME_503[] PROGMEM = "mellow_yellow";
+static const char COLOR_NAME_504[] PROGMEM = "melon";
+static const char COLOR_NAME_505[] PROGMEM = "midnight_blue";
+static const char COLOR_NAME_506[] PROGMEM = "midnight_green_eagle_green";
+static const char COLOR_NAME_507[] PROGMEM = "mikado_yellow";
+static const char COLOR_NAME_508[] PROGMEM = "mint";
+static const char COLOR_NAME_509[] PROGMEM = "mint_cream";
+static const char COLOR_NAME_510[] PROGMEM = "mint_green";
+static const char COLOR_NAME_511[] PROGMEM = "misty_rose";
+static const char COLOR_NAME_512[] PROGMEM = "moccasin";
+static const char COLOR_NAME_513[] PROGMEM = "mode_beige";
+static const char COLOR_NAME_514[] PROGMEM = "moonstone_blue";
+static const char COLOR_NAME_515[] PROGMEM = "mordant_red_19";
+static const char COLOR_NAME_516[] PROGMEM = "moss_green";
+static const char COLOR_NAME_517[] PROGMEM = "mountain_meadow";
+static const char COLOR_NAME_518[] PROGMEM = "mountbatten_pink";
+static const char COLOR_NAME_519[] PROGMEM = "msu_green";
+static const char COLOR_NAME_520[] PROGMEM = "mulberry";
+static const char COLOR_NAME_521[] PROGMEM = "mustard";
+static const char COLOR_NAME_522[] PROGMEM = "myrtle";
+static const char COLOR_NAME_523[] PROGMEM = "nadeshiko_pink";
+static const char COLOR_NAME_524[] PROGMEM = "napier_green";
+static const char COLOR_NAME_525[] PROGMEM = "naples_yellow";
+static const char COLOR_NAME_526[] PROGMEM = "navajo_white";
+static const char COLOR_NAME_527[] PROGMEM = "navy_blue";
+static const char COLOR_NAME_528[] PROGMEM = "neon_carrot";
+static const char COLOR_NAME_529[] PROGMEM = "neon_fuchsia";
+static const char COLOR_NAME_530[] PROGMEM = "neon_green";
+static const char COLOR_NAME_531[] PROGMEM = "new_york_pink";
+static const char COLOR_NAME_532[] PROGMEM = "non_photo_blue";
+static const char COLOR_NAME_533[] PROGMEM = "north_texas_green";
+static const char COLOR_NAME_534[] PROGMEM = "ocean_boat_blue";
+static const char COLOR_NAME_535[] PROGMEM = "ochre";
+static const char COLOR_NAME_536[] PROGMEM = "office_green";
+static const char COLOR_NAME_537[] PROGMEM = "old_gold";
+static const char COLOR_NAME_538[] PROGMEM = "old_lace";
+static const char COLOR_NAME_539[] PROGMEM = "old_lavender";
+static const char COLOR_NAME_540[] PROGMEM = "old_mauve";
+static const char COLOR_NAME_541[] PROGMEM = "old_rose";
+static const char COLOR_NAME_542[] PROGMEM = "olive";
+static const char COLOR_NAME_543[] PROGMEM = "olive_drab_7";
+static const char COLOR_NAME_544[] PROGMEM = "olive_drab_web_olive_drab_3";
+static const char COLOR_NAME_545[] PROGMEM = "olivine";
+static const char COLOR_NAME_546[] PROGMEM = "onyx";
+static const char COLOR_NAME_547[] PROGMEM = "opera_mauve";
+static const char COLOR_NAME_548[] PROGMEM = "orange_color_wheel";
+static const char COLOR_NAME_549[] PROGMEM = "orange_peel";
+static const char COLOR_NAME_550[] PROGMEM = "orange_red";
+static const char COLOR_NAME_551[] PROGMEM = "orange_ryb";
+static const char COLOR_NAME_552[] PROGMEM = "orange_web_color";
+static const char COLOR_NAME_553[] PROGMEM = "orchid";
+static const char COLOR_NAME_554[] PROGMEM = "otter_brown";
+static const char COLOR_NAME_555[] PROGMEM = "ou_crimson_red";
+static const char COLOR_NAME_556[] PROGMEM = "outer_space";
+static const char COLOR_NAME_557[] PROGMEM = "outrageous_orange";
+static const char COLOR_NAME_558[] PROGMEM = "oxford_blue";
+static const char COLOR_NAME_559[] PROGMEM = "pakistan_green";
+static const char COLOR_NAME_560[] PROGMEM = "palatinate_blue";
+static const char COLOR_NAME_561[] PROGMEM = "palatinate_purple";
+static const char COLOR_NAME_562[] PROGMEM = "pale_aqua";
+static const char COLOR_NAME_563[] PROGMEM = "pale_blue";
+static const char COLOR_NAME_564[] PROGMEM = "pale_brown";
+static const char COLOR_NAME_565[] PROGMEM = "pale_carmine";
+static const char COLOR_NAME_566[] PROGMEM = "pale_cerulean";
+static const char COLOR_NAME_567[] PROGMEM = "pale_chestnut";
+static const char COLOR_NAME_568[] PROGMEM = "pale_copper";
+static const char COLOR_NAME_569[] PROGMEM = "pale_cornflower_blue";
+static const char COLOR_NAME_570[] PROGMEM = "pale_gold";
+static const char COLOR_NAME_571[] PROGMEM = "pale_goldenrod";
+static const char COLOR_NAME_572[] PROGMEM = "pale_green";
+static const char COLOR_NAME_573[] PROGMEM = "pale_lavender";
+static const char COLOR_NAME_574[] PROGMEM = "pale_magenta";
+static const char COLOR_NAME_575[] PROGMEM = "pale_pink";
+static const char COLOR_NAME_576[] PROGMEM = "pale_plum";
+static const char COLOR_NAME_577[] PROGMEM = "pale_red_violet";
+static const char COLOR_NAME_578[] PROGMEM = "pale_robin_egg_blue";
+static const char COLOR_NAME_579[] PROGMEM = "pale_silver";
+static const char COLOR_NAME_580[] PROGMEM = "pale_spring_bud";
+static const char COLOR_NAME_581[] PROGMEM = "pale_taupe";
+static const char COLOR_NAME_582[] PROGMEM = "pale_violet_red";
+static const char COLOR_NAME_583[] PROGMEM = "pansy_purple";
+static const char COLOR_NAME_584[] PROGMEM = "papaya_whip";
+static const char COLOR_NAME_585[] PROGMEM = "paris_green";
+static const char COLOR_NAME_586[] PROGMEM = "pastel_blue";
+static const char COLOR_NAME_587[] PROGMEM = "pastel_brown";
+static const char COLOR_NAME_588[] PROGMEM = "pastel_gray";
+static const char COLOR_NAME_589[] PROGMEM = "pastel_green";
+static const char COLOR_NAME_590[] PROGMEM = "pastel_magenta";
+static const char COLOR_NAME_591[] PROGMEM = "pastel_orange";
+static const char COLOR_NAME_592[] PROGMEM = "pastel_pink";
+static const char COLOR_NAME_593[] PROGMEM = "pastel_purple";
+static const char COLOR_NAME_594[] PROGMEM = "pastel_red";
+static const char COLOR_NAME_595[] PROGMEM = "pastel_violet";
+static const char COLOR_NAME_596[] PROGMEM = "pastel_yellow";
+static const char COLOR_NAME_597[] PROGMEM = "patriarch";
+static const char COLOR_NAME_598[] PROGMEM = "payne_s_grey";
+static const char COLOR_NAME_599[] PROGMEM = "peach";
+static const char COLOR_NAME_600[] PROGMEM = "peach_crayola";
+static const char COLOR_NAME_601[] PROGMEM = "peach_orange";
+static const char COLOR_NAME_602[] PROGMEM = "peach_puff";
+static const char COLOR_NAME_603[] PROGMEM = "peach_yellow";
+static const char COLOR_NAME_604[] PROGMEM = "pear";
+static const char COLOR_NAME_605[] PROGMEM = "pearl";
+static const char COLOR_NAME_606[] PROGMEM = "pearl_aqua";
+static const char COLOR_NAME_607[] PROGMEM = "pearly_purple";
+static const char COLOR_NAME_608[] PROGMEM = "peridot";
+static const char COLOR_NAME_609[] PROGMEM = "periwinkle";
+static const char COLOR_NAME_610[] PROGMEM = "persian_blue";
+static const char COLOR_NAME_611[] PROGMEM = "persian_green";
+static const char COLOR_NAME_612[] PROGMEM = "persian_indigo";
+static const char COLOR_NAME_613[] PROGMEM = "persian_orange";
+static const char COLOR_NAME_614[] PROGMEM = "persian_pink";
+static const char COLOR_NAME_615[] PROGMEM = "persian_plum";
+static const char COLOR_NAME_616[] PROGMEM = "persian_red";
+static const char COLOR_NAME_617[] PROGMEM = "persian_rose";
+static const char COLOR_NAME_618[] PROGMEM = "persimmon";
+static const char COLOR_NAME_619[] PROGMEM = "peru";
+static const char COLOR_NAME_620[] PROGMEM = "phlox";
+static const char COLOR_NAME_621[] PROGMEM = "phthalo_blue";
+static const char COLOR_NAME_622[] PROGMEM = "phthalo_green";
+static const char COLOR_NAME_623[] PROGMEM = "piggy_pink";
+static const char COLOR_NAME_624[] PROGMEM = "pine_green";
+static const char COLOR_NAME_625[] PROGMEM = "pink";
+static const char COLOR_NAME_626[] PROGMEM = "pink_lace";
+static const char COLOR_NAME_627[] PROGMEM = "pink_orange";
+static const char COLOR_NAME_628[] PROGMEM = "pink_pearl";
+static const char COLOR_NAME_629[] PROGMEM = "pink_sherbet";
+static const char COLOR_NAME_630[] PROGMEM = "pistachio";
+static const char COLOR_NAME_631[] PROGMEM = "platinum";
+static const char COLOR_NAME_632[] PROGMEM = "plum_traditional";
+static const char COLOR_NAME_633[] PROGMEM = "plum_web";
+static const char COLOR_NAME_634[] PROGMEM = "portland_orange";
+static const char COLOR_NAME_635[] PROGMEM = "powder_blue_web";
+static const char COLOR_NAME_636[] PROGMEM = "princeton_orange";
+static const char COLOR_NAME_637[] PROGMEM = "prune";
+static const char COLOR_NAME_638[] PROGMEM = "prussian_blue";
+static const char COLOR_NAME_639[] PROGMEM = "psychedelic_purple";
+static const char COLOR_NAME_640[] PROGMEM = "puce";
+static const char COLOR_NAME_641[] PROGMEM = "pumpkin";
+static const char COLOR_NAME_642[] PROGMEM = "purple_heart";
+static const char COLOR_NAME_643[] PROGMEM = "purple_html_css";
+static const char COLOR_NAME_644[] PROGMEM = "purple_mountain_majesty";
+static const char COLOR_NAME_645[] PROGMEM = "purple_munsell";
+static const char COLOR_NAME_646[] PROGMEM = "purple_pizzazz";
+static const char COLOR_NAME_647[] PROGMEM = "purple_taupe";
+static const char COLOR_NAME_648[] PROGMEM = "purple_x11";
+static const char COLOR_NAME_649[] PROGMEM = "quartz";
+static const char COLOR_NAME_650[] PROGMEM = "rackley";
+static const char COLOR_NAME_651[] PROGMEM = "radical_red";
+static const char COLOR_NAME_652[] PROGMEM = "rajah";
+static const char COLOR_NAME_653[] PROGMEM = "raspberry";
+static const char COLOR_NAME_654[] PROGMEM = "raspberry_glace";
+static const char COLOR_NAME_655[] PROGMEM = "raspberry_pink";
+static const char COLOR_NAME_656[] PROGMEM = "raspberry_rose";
+static const char COLOR_NAME_657[] PROGMEM = "raw_umber";
+static const char COLOR_NAME_658[] PROGMEM = "razzle_dazzle_rose";
+static const char COLOR_NAME_659[] PROGMEM = "razzmatazz";
+static const char COLOR_NAME_660[] PROGMEM = "red";
+static const char COLOR_NAME_661[] PROGMEM = "red_brown";
+static const char COLOR_NAME_662[] PROGMEM = "red_devil";
+static const char COLOR_NAME_663[] PROGMEM = "red_munsell";
+static const char COLOR_NAME_664[] PROGMEM = "red_ncs";
+static const char COLOR_NAME_665[] PROGMEM = "red_orange";
+static const char COLOR_NAME_666[] PROGMEM = "red_pigment";
+static const char COLOR_NAME_667[] PROGMEM = "red_ryb";
+static const char COLOR_NAME_668[] PROGMEM = "red_violet";
+static const char COLOR_NAME_669[] PROGMEM = "redwood";
+static const char COLOR_NAME_670[] PROGMEM = "regalia";
+static const char COLOR_NAME_671[] PROGMEM = "resolution_blue";
+static const char COLOR_NAME_672[] PROGMEM = "rich_black";
+static const char COLOR_NAME_673[] PROGMEM = "rich_brilliant_lavender";
+static const char COLOR_NAME_674[] PROGMEM = "rich_carmine";
+static const char COLOR_NAME_675[] PROGMEM = "rich_electric_blue";
+static const char COLOR_NAME_676[] PROGMEM = "rich_lavender";
+static const char COLOR_NAME_677[] PROGMEM = "rich_lilac";
+static const char COLOR_NAME_678[] PROGMEM = "rich_maroon";
+static const char COLOR_NAME_679[] PROGMEM = "rifle_green";
+static const char COLOR_NAME_680[] PROGMEM = "robin_egg_blue";
+static const char COLOR_NAME_681[] PROGMEM = "rose";
+static const char COLOR_NAME_682[] PROGMEM = "rose_bonbon";
+static const char COLOR_NAME_683[] PROGMEM = "rose_ebony";
+static const char COLOR_NAME_684[] PROGMEM = "rose_gold";
+static const char COLOR_NAME_685[] PROGMEM = "rose_madder";
+static const char COLOR_NAME_686[] PROGMEM = "rose_pink";
+static const char COLOR_NAME_687[] PROGMEM = "rose_quartz";
+static const char COLOR_NAME_688[] PROGMEM = "rose_taupe";
+static const char COLOR_NAME_689[] PROGMEM = "rose_vale";
+static const char COLOR_NAME_690[] PROGMEM = "rosewood";
+static const char COLOR_NAME_691[] PROGMEM = "rosso_corsa";
+static const char COLOR_NAME_692[] PROGMEM = "rosy_brown";
+static const char COLOR_NAME_693[] PROGMEM = "royal_azure";
+static const char COLOR_NAME_694[] PROGMEM = "royal_blue_traditional";
+static const char COLOR_NAME_695[] PROGMEM = "royal_blue_web";
+static const char COLOR_NAME_696[] PROGMEM = "royal_fuchsia";
+static const char COLOR_NAME_697[] PROGMEM = "royal_purple";
+static const char COLOR_NAME_698[] PROGMEM = "royal_yellow";
+static const char COLOR_NAME_699[] PROGMEM = "rubine_red";
+static const char COLOR_NAME_700[] PROGMEM = "ruby";
+static const char COLOR_NAME_701[] PROGMEM = "ruby_red";
+static const char COLOR_NAME_702[] PROGMEM = "ruddy";
+static const char COLOR_NAME_703[] PROGMEM = "ruddy_brown";
+static const char COLOR_NAME_704[] PROGMEM = "ruddy_pink";
+static const char COLOR_NAME_705[] PROGMEM = "rufous";
+static const char COLOR_NAME_706[] PROGMEM = "russet";
+static const char COLOR_NAME_707[] PROGMEM = "rust";
+static const char COLOR_NAME_708[] PROGMEM = "rusty_red";
+static const char COLOR_NAME_709[] PROGMEM = "sacramento_state_green";
+static const char COLOR_NAME_710[] PROGMEM = "saddle_brown";
+static const char COLOR_NAME_711[] PROGMEM = "safety_orange_blaze_orange";
+static const char COLOR_NAME_712[] PROGMEM = "saffron";
+static const char COLOR_NAME_713[] PROGMEM = "salmon";
+static const char COLOR_NAME_714[] PROGMEM = "salmon_pink";
+static const char COLOR_NAME_715[] PROGMEM = "sand";
+static const char COLOR_NAME_716[] PROGMEM = "sand_dune";
+static const char COLOR_NAME_717[] PROGMEM = "sandstorm";
+static const char COLOR_NAME_718[] PROGMEM = "sandy_brown";
+static const char COLOR_NAME_719[] PROGMEM = "sandy_taupe";
+static const char COLOR_NAME_720[] PROGMEM = "sangria";
+static const char COLOR_NAME_721[] PROGMEM = "sap_green";
+static const char COLOR_NAME_722[] PROGMEM = "sapphire";
+static const char COLOR_NAME_723[] PROGMEM = "sapphire_blue";
+static const char COLOR_NAME_724[] PROGMEM = "satin_sheen_gold";
+static const char COLOR_NAME_725[] PROGMEM = "scarlet";
+static const char COLOR_NAME_726[] PROGMEM = "scarlet_crayola";
+static const char COLOR_NAME_727[] PROGMEM = "school_bus_yellow";
+static const char COLOR_NAME_728[] PROGMEM = "screamin_green";
+static const char COLOR_NAME_729[] PROGMEM = "sea_blue";
+static const char COLOR_NAME_730[] PROGMEM = "sea_green";
+static const char COLOR_NAME_731[] PROGMEM = "seal_brown";
+static const char COLOR_NAME_732[] PROGMEM = "seashell";
+static const char COLOR_NAME_733[] PROGMEM = "selective_yellow";
+static const char COLOR_NAME_734[] PROGMEM = "sepia";
+static const char COLOR_NAME_735[] PROGMEM = "shadow";
+static const char COLOR_NAME_736[] PROGMEM = "shamrock_green";
+static const char COLOR_NAME_737[] PROGMEM = "shocking_pink";
+static const char COLOR_NAME_738[] PROGMEM = "shocking_pink_crayola";
+static const char COLOR_NAME_739[] PROGMEM = "sienna";
+static const char COLOR_NAME_740[] PROGMEM = "silver";
+static const char COLOR_NAME_741[] PROGMEM = "sinopia";
+static const char COLOR_NAME_742[] PROGMEM = "skobeloff";
+static const char COLOR_NAME_743[] PROGMEM = "sky_blue";
+static const char COLOR_NAME_744[] PROGMEM = "sky_magenta";
+static const char COLOR_NAME_745[] PROGMEM = "slate_blue";
+static const char COLOR_NAME_746[] PROGMEM = "slate_gray";
+static const char COLOR_NAME_747[] PROGMEM = "smalt_dark_powder_blue";
+static const char COLOR_NAME_748[] PROGMEM = "smokey_topaz";
+static const char COLOR_NAME_749[] PROGMEM = "smoky_black";
+static const char COLOR_NAME_750[] PROGMEM = "snow";
+static const char COLOR_NAME_751[] PROGMEM = "spiro_disco_ball";
+static const char COLOR_NAME_752[] PROGMEM = "spring_bud";
+static const char COLOR_NAME_753[] PROGMEM = "spring_green";
+static const char COLOR_NAME_754[] PROGMEM = "st_patrick_s_blue";
+static const char COLOR_NAME_755[] PROGMEM = "steel_blue";
+static const char COLOR_NAME_756[] PROGMEM = "stil_de_grain_yellow";
+static const char COLOR_NAME_757[] PROGMEM = "stizza";
+static const char COLOR_NAME_758[] PROGMEM = "stormcloud";
+static const char COLOR_NAME_759[] PROGMEM = "straw";
+static const char COLOR_NAME_760[] PROGMEM = "sunglow";
+static const char COLOR_NAME_761[] PROGMEM = "sunset";
+static const char COLOR_NAME_762[] PROGMEM = "tan";
+static const char COLOR_NAME_763[] PROGMEM = "tangelo";
+static const char COLOR_NAME_764[] PROGMEM = "tangerine";
+static const char COLOR_NAME_765[] PROGMEM = "tangerine_yellow";
+static const char COLOR_NAME_766[] PROGMEM = "tango_pink";
+static const char COLOR_NAME_767[] PROGMEM = "taupe";
+static const char COLOR_NAME_768[] PROGMEM = "taupe_gray";
+static const char COLOR_NAME_769[] PROGMEM = "tea_green";
+static const char COLOR_NAME_770[] PROGMEM = "tea_rose_orange";
+static const char COLOR_NAME_771[] PROGMEM = "tea_rose_rose";
+static const char COLOR_NAME_772[] PROGMEM = "teal";
+static const char COLOR_NAME_773[] PROGMEM = "teal_blue";
+static const char COLOR_NAME_774[] PROGMEM = "teal_green";
+static const char COLOR_NAME_775[] PROGMEM = "telemagenta";
+static const char COLOR_NAME_776[] PROGMEM = "tenn_tawny";
+static const char COLOR_NAME_777[] PROGMEM = "terra_cotta";
+static const char COLOR_NAME_778[] PROGMEM = "thistle";
+static const char COLOR_NAME_779[] PROGMEM = "thulian_pink";
+static const char COLOR_NAME_780[] PROGMEM = "tickle_me_pink";
+static const char COLOR_NAME_781[] PROGMEM = "tiffany_blue";
+static const char COLOR_NAME_782[] PROGMEM = "tiger_s_eye";
+static const char COLOR_NAME_783[] PROGMEM = "timberwolf";
+static const char COLOR_NAME_784[] PROGMEM = "titanium_yellow";
+static const char COLOR_NAME_785[] PROGMEM = "tomato";
+static const char COLOR_NAME_786[] PROGMEM = "toolbox";
+static const char COLOR_NAME_787[] PROGMEM = "topaz";
+static const char COLOR_NAME_788[] PROGMEM = "tractor_red";
+static const char COLOR_NAME_789[] PROGMEM = "trolley_grey";
+static const char COLOR_NAME_790[] PROGMEM = "tropical_rain_forest";
+static const char COLOR_NAME_791[] PROGMEM = "true_blue";
+static const char COLOR_NAME_792[] PROGMEM = "tufts_blue";
+static const char COLOR_NAME_793[] PROGMEM = "tumbleweed";
+static const char COLOR_NAME_794[] PROGMEM = "turkish_rose";
+static const char COLOR_NAME_795[] PROGMEM = "turquoise";
+static const char COLOR_NAME_796[] PROGMEM = "turquoise_blue";
+static const char COLOR_NAME_797[] PROGMEM = "turquoise_green";
+static const char COLOR_NAME_798[] PROGMEM = "tuscan_red";
+static const char COLOR_NAME_799[] PROGMEM = "twilight_lavender";
+static const char COLOR_NAME_800[] PROGMEM = "tyrian_purple";
+static const char COLOR_NAME_801[] PROGMEM = "ua_blue";
+static const char COLOR_NAME_802[] PROGMEM = "ua_red";
+static const char COLOR_NAME_803[] PROGMEM = "ube";
+static const char COLOR_NAME_804[] PROGMEM = "ucla_blue";
+static const char COLOR_NAME_805[] PROGMEM = "ucla_gold";
+static const char COLOR_NAME_806[] PROGMEM = "ufo_green";
+static const char COLOR_NAME_807[] PROGMEM = "ultra_pink";
+static const char COLOR_NAME_808[] PROGMEM = "ultramarine";
+static const char COLOR_NAME_809[] PROGMEM = "ultramarine_blue";
+static const char COLOR_NAME_810[] PROGMEM = "umber";
+static const char COLOR_NAME_811[] PROGMEM = "unbleached_silk";
+static const char COLOR_NAME_812[] PROGMEM = "united_nations_blue";
+static const char COLOR_NAME_813[] PROGMEM = "university_of_california_gold";
+static const char COLOR_NAME_814[] PROGMEM = "unmellow_yellow";
+static const char COLOR_NAME_815[] PROGMEM = "up_forest_green";
+static const char COLOR_NAME_816[] PROGMEM = "up_maroon";
+static const char COLOR_NAME_817[] PROGMEM = "upsdell_red";
+static const char COLOR_NAME_818[] PROGMEM = "urobilin";
+static const char COLOR_NAME_819[] PROGMEM = "usafa_blue";
+static const char COLOR_NAME_820[] PROGMEM = "usc_cardinal";
+static const char COLOR_NAME_821[] PROGMEM = "usc_gold";
+static const char COLOR_NAME_822[] PROGMEM = "utah_crimson";
+static const char COLOR_NAME_823[] PROGMEM = "vanilla";
+static const char COLOR_NAME_824[] PROGMEM = "vegas_gold";
+static const char COLOR_NAME_825[] PROGMEM = "venetian_red";
+static const char COLOR_NAME_826[] PROGMEM = "verdigris";
+static const char COLOR_NAME_827[] PROGMEM = "vermilion_cinnabar";
+static const char COLOR_NAME_828[] PROGMEM = "vermilion_plochere";
+static const char COLOR_NAME_829[] PROGMEM = "veronica";
+static const char COLOR_NAME_830[] PROGMEM = "violet";
+static const char COLOR_NAME_831[] PROGMEM = "violet_blue";
+static const char COLOR_NAME_832[] PROGMEM = "violet_color_wheel";
+static const char COLOR_NAME_833[] PROGMEM = "violet_ryb";
+static const char COLOR_NAME_834[] PROGMEM = "violet_web";
+static const char COLOR_NAME_835[] PROGMEM = "viridian";
+static const char COLOR_NAME_836[] PROGMEM = "vivid_auburn";
+static const char COLOR_NAME_837[] PROGMEM = "vivid_burgundy";
+static const char COLOR_NAME_838[] PROGMEM = "vivid_cerise";
+static const char COLOR_NAME_839[] PROGMEM = "vivid_tangerine";
+static const char COLOR_NAME_840[] PROGMEM = "vivid_violet";
+static const char COLOR_NAME_841[] PROGMEM = "warm_black";
+static const char COLOR_NAME_842[] PROGMEM = "waterspout";
+static const char COLOR_NAME_843[] PROGMEM = "wenge";
+static const char COLOR_NAME_844[] PROGMEM = "wheat";
+static const char COLOR_NAME_845[] PROGMEM = "white";
+static const char COLOR_NAME_846[] PROGMEM = "white_smoke";
+static const char COLOR_NAME_847[] PROGMEM = "wild_blue_yonder";
+static const char COLOR_NAME_848[] PROGMEM = "wild_strawberry";
+static const char COLOR_NAME_849[] PROGMEM = "wild_watermelon";
+static const char COLOR_NAME_850[] PROGMEM = "wine";
+static const char COLOR_NAME_851[] PROGMEM = "wine_dregs";
+static const char COLOR_NAME_852[] PROGMEM = "wisteria";
+static const char COLOR_NAME_853[] PROGMEM = "wood_brown";
+static const char COLOR_NAME_854[] PROGMEM = "xanadu";
+static const char COLOR_NAME_855[] PROGMEM = "yale_blue";
+static const char COLOR_NAME_856[] PROGMEM = "yellow";
+static const char COLOR_NAME_857[] PROGMEM = "yellow_green";
+static const char COLOR_NAME_858[] PROGMEM = "yellow_munsell";
+static const char COLOR_NAME_859[] PROGMEM = "yellow_ncs";
+static const char COLOR_NAME_860[] PROGMEM = "yellow_orange";
+static const char COLOR_NAME_861[] PROGMEM = "yellow_process";
+static const char COLOR_NAME_862[] PROGMEM = "yellow_ryb";
+static const char COLOR_NAME_863[] PROGMEM = "zaffre";
+static const char COLOR_NAME_864[] PROGMEM = "zinnwaldite_brown";
+
+static const char *const COLOR_NAMES[] PROGMEM = {
+    COLOR_NAME_0, COLOR_NAME_1, COLOR_NAME_2, COLOR_NAME_3, COLOR_NAME_4, COLOR_NAME_5, COLOR_NAME_6, COLOR_NAME_7,
+    COLOR_NAME_8, COLOR_NAME_9, COLOR_NAME_10, COLOR_NAME_11, COLOR_NAME_12, COLOR_NAME_13, COLOR_NAME_14, COLOR_NAME_15,
+    COLOR_NAME_16, COLOR_NAME_17, COLOR_NAME_18, COLOR_NAME_19, COLOR_NAME_20, COLOR_NAME_21, COLOR_NAME_22, COLOR_NAME_23,
+    COLOR_NAME_24, COLOR_NAME_25, COLOR_NAME_26, COLOR_NAME_27, COLOR_NAME_28, COLOR_NAME_29, COLOR_NAME_30, COLOR_NAME_31,
+    COLOR_NAME_32, COLOR_NAME_33, COLOR_NAME_34, COLOR_NAME_35, COLOR_NAME_36, COLOR_NAME_37, COLOR_NAME_38, COLOR_NAME_39,
+    COLOR_NAME_40, COLOR_NAME_41, COLOR_NAME_42, COLOR_NAME_43, COLOR_NAME_44, COLOR_NAME_45, COLOR_NAME_46, COLOR_NAME_47,
+    COLOR_NAME_48, COLOR_NAME_49, COLOR_NAME_50, COLOR_NAME_51, COLOR_NAME_52, COLOR_NAME_53, COLOR_NAME_54, COLOR_NAME_55,
+    COLOR_NAME_56, COLOR_NAME_57, COLOR_NAME_58, COLOR_NAME_59, COLOR_NAME_60, COLOR_NAME_61, COLOR_NAME_62, COLOR_NAME_63,
+    COLOR_NAME_64, COLOR_NAME_65, COLOR_NAME_66, COLOR_NAME_67, COLOR_NAME_68, COLOR_NAME_69, COLOR_NAME_70, COLOR_NAME_71,
+    COLOR_NAME_72, COLOR_NAME_73, COLOR_NAME_74, COLOR_NAME_75, COLOR_NAME_76, COLOR_NAME_77, COLOR_NAME_78, COLOR_NAME_79,
+    COLOR_NAME_80, COLOR_NAME_81, COLOR_NAME_82, COLOR_NAME_83, COLOR_NAME_84, COLOR_NAME_85, COLOR_NAME_86, COLOR_NAME_87,
+    COLOR_NAME_88, COLOR_NAME_89, COLOR_NAME_90, COLOR_NAME_91, COLOR_NAME_92, COLOR_NAME_93, COLOR_NAME_94, COLOR_NAME_95,
+    COLOR_NAME_96, COLOR_NAME_97, COLOR_NAME_98, COLOR_NAME_99, COLOR_NAME_100, COLOR_NAME_101, COLOR_NAME_102, COLOR_NAME_103,
+    COLOR_NAME_104, COLOR_NAME_105, COLOR_NAME_106, COLOR_NAME_107, COLOR_NAME_108, COLOR_NAME_109, COLOR_NAME_110, COLOR_NAME_111,
+    COLOR_NAME_112, COLOR_NAME_113, COLOR_NAME_114, COLOR_NAME_115, COLOR_NAME_116, COLOR_NAME_117, COLOR_NAME_118, COLOR_NAME_119,
+    COLOR_NAME_120, COLOR_NAME_121, COLOR_NAME_122, COLOR_NAME_123, COLOR_NAME_124, COLOR_NAME_125, COLOR_NAME_126, COLOR_NAME_127,
+    COLOR_NAME_128, COLOR_NAME_129, COLOR_NAME_130, COLOR_NAME_131, COLOR_NAME_132, COLOR_NAME_133, COLOR_NAME_134, COLOR_NAME_135,
+    COLOR_NAME_136, COLOR_NAME_137, COLOR_NAME_138, COLOR_NAME_139, COLOR_NAME_140, COLOR_NAME_141, COLOR_NAME_142, COLOR_NAME_143,
+    COLOR_NAME_144, COLOR_NAME_145, COLOR_NAME_146, COLOR_NAME_147, COLOR_NAME_148, COLOR_NAME_149, COLOR_NAME_150, COLOR_NAME_151,
+    COLOR_NAME_152, COLOR_NAME_153, COLOR_NAME_154, COLOR_NAME_155, COLOR_NAME_156, COLOR_NAME_157, COLOR_NAME_158, COLOR_NAME_159,
+    COLOR_NAME_160, COLOR_NAME_161, COLOR_NAME_162, COLOR_NAME_163, COLOR_NAME_164, COLOR_NAME_165, COLOR_NAME_166, COLOR_NAME_167,
+    COLOR_NAME_168, COLOR_NAME_169, COLOR_NAME_170, COLOR_NAME_171, COLOR_NAME_172, COLOR_NAME_173, COLOR_NAME_174, COLOR_NAME_175,
+    COLOR_NAME_176, COLOR_NAME_177, COLOR_NAME_178, COLOR_NAME_179, COLOR_NAME_180, COLOR_NAME_181, COLOR_NAME_182, COLOR_NAME_183,
+    COLOR_NAME_184, COLOR_NAME_185, COLOR_NAME_186, COLOR_NAME_187, COLOR_NAME_188, COLOR_NAME_189, COLOR_NAME_190, COLOR_NAME_191,
+    COLOR_NAME_192, COLOR_NAME_193, COLOR_NAME_194, COLOR_NAME_195, COLOR_NAME_196, COLOR_NAME_197, COLOR_NAME_198, COLOR_NAME_199,
+    COLOR_NAME_200, COLOR_NAME_201, COLOR_NAME_202, COLOR_NAME_203, COLOR_NAME_204, COLOR_NAME_205, COLOR_NAME_206, COLOR_NAME_207,
+    COLOR_NAME_208, COLOR_NAME_209, COLOR_NAME_210, COLOR_NAME_211, COLOR_NAME_212, COLOR_NAME_213, COLOR_NAME_214, COLOR_NAME_215,
+    COLOR_NAME_216, COLOR_NAME_217, COLOR_NAME_218, COLOR_NAME_219, COLOR_NAME_220, COLOR_NAME_221, COLOR_NAME_222, COLOR_NAME_223,
+    COLOR_NAME_224, COLOR_NAME_225, COLOR_NAME_226, COLOR_NAME_227, COLOR_NAME_228, COLOR_NAME_229, COLOR_NAME_230, COLOR_NAME_231,
+    COLOR_NAME_232, COLOR_NAME_233, COLOR_NAME_234, COLOR_NAME_235, COLOR_NAME_236, COLOR_NAME_237, COLOR_NAME_238, COLOR_NAME_239,
+    COLOR_NAME_240, COLOR_NAME_241, COLOR_NAME_242, COLOR_NAME_243, COLOR_NAME_244, COLOR_NAME_245, COLOR_NAME_246, COLOR_NAME_247,
+    COLOR_NAME_248, COLOR_NAME_249, COLOR_NAME_250, COLOR_NAME_251, COLOR_NAME_252, COLOR_NAME_253, COLOR_NAME_254, COLOR_NAME_255,
+    COLOR_NAME_256, COLOR_NAME_257, COLOR_NAME_258, COLOR_NAME_259, COLOR_NAME_260, COLOR_NAME_261, COLOR_NAME_262, COLOR_NAME_263,
+    COLOR_NAME_264, COLOR_NAME_265, COLOR_NAME_266, COLOR_NAME_267, COLOR_NAME_268, COLOR_NAME_269, COLOR_NAME_270, COLOR_NAME_271,
+    COLOR_NAME_272, COLOR_NAME_273, COLOR_NAME_274, COLOR_NAME_275, COLOR_NAME_276, COLOR_NAME_277, COLOR_NAME_278, COLOR_NAME_279,
+    COLOR_NAME_280, COLOR_NAME_281, COLOR_NAME_282, COLOR_NAME_283, COLOR_NAME_284, COLOR_NAME_285, COLOR_NAME_286, COLOR_NAME_287,
+    COLOR_NAME_288, COLOR_NAME_289, COLOR_NAME_290, COLOR_NAME_291, COLOR_NAME_292, COLOR_NAME_293, COLOR_NAME_294, COLOR_NAME_295,
+    COLOR_NAME_296, COLOR_NAME_297, COLOR_NAME_298, COLOR_NAME_299, COLOR_NAME_300, COLOR_NAME_301, COLOR_NAME_302, COLOR_NAME_303,
+    COLOR_NAME_304, COLOR_NAME_305, COLOR_NAME_306, COLOR_NAME_307, COLOR_NAME_308, COLOR_NAME_309, COLOR_NAME_310, COLOR_NAME_311,
+    COLOR_NAME_312, COLOR_NAME_313, COLOR_NAME_314, COLOR_NAME_315, COLOR_NAME_316, COLOR_NAME_317, COLOR_NAME_318, COLOR_NAME_319,
+    COLOR_NAME_320, COLOR_NAME_321, COLOR_NAME_322, COLOR_NAME_323, COLOR_NAME_324, COLOR_NAME_325, COLOR_NAME_326, COLOR_NAME_327,
+    COLOR_NAME_328, COLOR_NAME_329, COLOR_NAME_330, COLOR_NAME_331, COLOR_NAME_332, COLOR_NAME_333, COLOR_NAME_334, COLOR_NAME_335,
+    COLOR_NAME_336, COLOR_NAME_337, COLOR_NAME_338, COLOR_NAME_339, COLOR_NAME_340, COLOR_NAME_341, COLOR_NAME_342, COLOR_NAME_343,
+    COLOR_NAME_344, COLOR_NAME_345, COLOR_NAME_346, COLOR_NAME_347, COLOR_NAME_348, COLOR_NAME_349, COLOR_NAME_350, COLOR_NAME_351,
+    COLOR_NAME_352, COLOR_NAME_353, COLOR_NAME_354, COLOR_NAME_355, COLOR_NAME_356, COLOR_NAME_357, COLOR_NAME_358, COLOR_NAME_359,
+    COLOR_NAME_360, COLOR_NAME_361, COLOR_NAME_362, COLOR_NAME_363, COLOR_NAME_364, COLOR_NAME_365, COLOR_NAME_366, COLOR_NAME_367,
+    COLOR_NAME_368, COLOR_NAME_369, COLOR_NAME_370, COLOR_NAME_371, COLOR_NAME_372, COLOR_NAME_373, COLOR_NAME_374, COLOR_NAME_375,
+    COLOR_NAME_376, COLOR_NAME_377, COLOR_NAME_378, COLOR_NAME_379, COLOR_NAME_380, COLOR_NAME_381, COLOR_NAME_382, COLOR_NAME_383,
+    COLOR_NAME_384, COLOR_NAME_385, COLOR_NAME_386, COLOR_NAME_387, COLOR_NAME_388, COLOR_NAME_389, COLOR_NAME_390, COLOR_NAME_391,
+    COLOR_NAME_392, COLOR_NAME_393, COLOR_NAME_394, COLOR_NAME_395, COLOR_NAME_396, COLOR_NAME_397, COLOR_NAME_398, COLOR_NAME_399,
+    COLOR_NAME_400, COLOR_NAME_401, COLOR_NAME_402, COLOR_NAME_403, COLOR_NAME_404, COLOR_NAME_405, COLOR_NAME_406, COLOR_NAME_407,
+    COLOR_NAME_408, COLOR_NAME_409, COLOR_NAME_410, COLOR_NAME_411, COLOR_NAME_412, COLOR_NAME_413, COLOR_NAME_414, COLOR_NAME_415,
+    COLOR_NAME_416, COLOR_NAME_417, COLOR_NAME_418, COLOR_NAME_419, COLOR_NAME_420, COLOR_NAME_421, COLOR_NAME_422, COLOR_NAME_423,
+    COLOR_NAME_424, COLOR_NAME_425, COLOR_NAME_426, COLOR_NAME_427, COLOR_NAME_428, COLOR_NAME_429, COLOR_NAME_430, COLOR_NAME_431,
+    COLOR_NAME_432, COLOR_NAME_433, COLOR_NAME_434, COLOR_NAME_435, COLOR_NAME_436, COLOR_NAME_437, COLOR_NAME_438, COLOR_NAME_439,
+    COLOR_NAME_440, COLOR_NAME_441, COLOR_NAME_442, COLOR_NAME_443, COLOR_NAME_444, COLOR_NAME_445, COLOR_NAME_446, COLOR_NAME_447,
+    COLOR_NAME_448, COLOR_NAME_449, COLOR_NAME_450, COLOR_NAME_451, COLOR_NAME_452, COLOR_NAME_453, COLOR_NAME_454, COLOR_NAME_455,
+    COLOR_NAME_456, COLOR_NAME_457, COLOR_NAME_458, COLOR_NAME_459, COLOR_NAME_460, COLOR_NAME_461, COLOR_NAME_462, COLOR_NAME_463,
+    COLOR_NAME_464, COLOR_NAME_465, COLOR_NAME_466, COLOR_NAME_467, COLOR_NAME_468, COLOR_NAME_469, COLOR_NAME_470, COLOR_NAME_471,
+    COLOR_NAME_472, COLOR_NAME_473, COLOR_NAME_474, COLOR_NAME_475, COLOR_NAME_476, COLOR_NAME_477, COLOR_NAME_478, COLOR_NAME_479,
+    COLOR_NAME_480, COLOR_NAME_481, COLOR_NAME_482, COLOR_NAME_483, COLOR_NAME_484, COLOR_NAME_485, COLOR_NAME_486, COLOR_NAME_487,
+    COLOR_NAME_488, COLOR_NAME_489, COLOR_NAME_490, COLOR_NAME_491, COLOR_NAME_492, COLOR_NAME_493, COLOR_NAME_494, COLOR_NAME_495,
+    COLOR_NAME_496, COLOR_NAME_497, COLOR_NAME_498, COLOR_NAME_499, COLOR_NAME_500, COLOR_NAME_501, COLOR_NAME_502, COLOR_NAME_503,
+    COLOR_NAME_504, COLOR_NAME_505, COLOR_NAME_506, COLOR_NAME_507, COLOR_NAME_508, COLOR_NAME_509, COLOR_NAME_510, COLOR_NAME_511,
+    COLOR_NAME_512, COLOR_NAME_513, COLOR_NAME_514, COLOR_NAME_515, COLOR_NAME_516, COLOR_NAME_517, COLOR_NAME_518, COLOR_NAME_519,
+    COLOR_NAME_520, COLOR_NAME_521, COLOR_NAME_522, COLOR_NAME_523, COLOR_NAME_524, COLOR_NAME_525, COLOR_NAME_526, COLOR_NAME_527,
+    COLOR_NAME_528, COLOR_NAME_529, COLOR_NAME_530, COLOR_NAME_531, COLOR_NAME_532, COLOR_NAME_533, COLOR_NAME_534, COLOR_NAME_535,
+    COLOR_NAME_536, COLOR_NAME_537, COLOR_NAME_538, COLOR_NAME_539, COLOR_NAME_540, COLOR_NAME_541, COLOR_NAME_542, COLOR_NAME_543,
+    COLOR_NAME_544, COLOR_NAME_545, COLOR_NAME_546, COLOR_NAME_547, COLOR_NAME_548, COLOR_NAME_549, COLOR_NAME_550, COLOR_NAME_551,
+    COLOR_NAME_552, COLOR_NAME_553, COLOR_NAME_554, COLOR_NAME_555, COLOR_NAME_556, COLOR_NAME_557, COLOR_NAME_558, COLOR_NAME_559,
+    COLOR_NAME_560, COLOR_NAME_561, COLOR_NAME_562, COLOR_NAME_563, COLOR_NAME_564, COLOR_NAME_565, COLOR_NAME_566, COLOR_NAME_567,
+    COLOR_NAME_568, COLOR_NAME_569, COLOR_NAME_570, COLOR_NAME_571, COLOR_NAME_572, COLOR_NAME_573, COLOR_NAME_574, COLOR_NAME_575,
+    COLOR_NAME_576, COLOR_NAME_577, COLOR_NAME_578, COLOR_NAME_579, COLOR_NAME_580, COLOR_NAME_581, COLOR_NAME_582, COLOR_NAME_583,
+    COLOR_NAME_584, COLOR_NAME_585, COLOR_NAME_586, COLOR_NAME_587, COLOR_NAME_588, COLOR_NAME_589, COLOR_NAME_590, COLOR_NAME_591,
+    COLOR_NAME_592, COLOR_NAME_593, COLOR_NAME_594, COLOR_NAME_595, COLOR_NAME_596, COLOR_NAME_597, COLOR_NAME_598, COLOR_NAME_599,
+    COLOR_NAME_600, COLOR_NAME_601, COLOR_NAME_602, COLOR_NAME_603, COLOR_NAME_604, COLOR_NAME_605, COLOR_NAME_606, COLOR_NAME_607,
+    COLOR_NAME_608, COLOR_NAME_609, COLOR_NAME_610, COLOR_NAME_611, COLOR_NAME_612, COLOR_NAME_613, COLOR_NAME_614, COLOR_NAME_615,
+    COLOR_NAME_616, COLOR_NAME_617, COLOR_NAME_618, COLOR_NAME_619, COLOR_NAME_620, COLOR_NAME_621, COLOR_NAME_622, COLOR_NAME_623,
+    COLOR_NAME_624, COLOR_NAME_625, COLOR_NAME_626, COLOR_NAME_627, COLOR_NAME_628, COLOR_NAME_629, COLOR_NAME_630, COLOR_NAME_631,
+    COLOR_NAME_632, COLOR_NAME_633, COLOR_NAME_634, COLOR_NAME_635, COLOR_NAME_636, COLOR_NAME_637, COLOR_NAME_638, COLOR_NAME_639,
+    COLOR_NAME_640, COLOR_NAME_641, COLOR_NAME_642, COLOR_NAME_643, COLOR_NAME_644, COLOR_NAME_645, COLOR_NAME_646, COLOR_NAME_647,
+    COLOR_NAME_648, COLOR_NAME_649, COLOR_NAME_650, COLOR_NAME_651, COLOR_NAME_652, COLOR_NAME_653, COLOR_NAME_654, COLOR_NAME_655,
+    COLOR_NAME_656, COLOR_NAME_657, COLOR_NAME_658, COLOR_NAME_659, COLOR_NAME_660, COLOR_NAME_661, COLOR_NAME_662, COLOR_NAME_663,
+    COLOR_NAME_664, COLOR_NAME_665, COLOR_NAME_666, COLOR_NAME_667, COLOR_NAME_668, COLOR_NAME_669, COLOR_NAME_670, COLOR_NAME_671,
+    COLOR_NAME_672, COLOR_NAME_673, COLOR_NAME_674, COLOR_NAME_675, COLOR_NAME_676, COLOR_NAME_677, COLOR_NAME_678, COLOR_NAME_679,
+    COLOR_NAME_680, COLOR_NAME_681, COLOR_NAME_682, COLOR_NAME_683, COLOR_NAME_684, COLOR_NAME_685, COLOR_NAME_686, COLOR_NAME_687,
+    COLOR_NAME_688, COLOR_NAME_689, COLOR_NAME_690, COLOR_NAME_691, COLOR_NAME_692, COLOR_NAME_693, COLOR_NAME_694, COLOR_NAME_695,
+    COLOR_NAME_696, COLOR_NAME_697, COLOR_NAME_698, COLOR_NAME_699, COLOR_NAME_700, COLOR_NAME_701, COLOR_NAME_702, COLOR_NAME_703,
+    COLOR_NAME_704, COLOR_NAME_705, COLOR_NAME_706, COLOR_NAME_707, COLOR_NAME_708, COLOR_NAME_709, COLOR_NAME_710, COLOR_NAME_711,
+    COLOR_NAME_712, COLOR_NAME_713, COLOR_NAME_714, COLOR_NAME_715, COLOR_NAME_716, COLOR_NAME_717, COLOR_NAME_718, COLOR_NAME_719,
+    COLOR_NAME_720, COLOR_NAME_721, COLOR_NAME_722, COLOR_NAME_723, COLOR_NAME_724, COLOR_NAME_725, COLOR_NAME_726, COLOR_NAME_727,
+    COLOR_NAME_728, COLOR_NAME_729, COLOR_NAME_730, COLOR_NAME_731, COLOR_NAME_732, COLOR_NAME_733, COLOR_NAME_734, COLOR_NAME_735,
+    COLOR_NAME_736, COLOR_NAME_737, COLOR_NAME_738, COLOR_NAME_739, COLOR_NAME_740, COLOR_NAME_741, COLOR_NAME_742, COLOR_NAME_743,
+    COLOR_NAME_744, COLOR_NAME_745, COLOR_NAME_746, COLOR_NAME_747, COLOR_NAME_748, COLOR_NAME_749, COLOR_NAME_750, COLOR_NAME_751,
+    COLOR_NAME_752, COLOR_NAME_753, COLOR_NAME_754, COLOR_NAME_755, COLOR_NAME_756, COLOR_NAME_757, COLOR_NAME_758, COLOR_NAME_759,
+    COLOR_NAME_760, COLOR_NAME_761, COLOR_NAME_762, COLOR_NAME_763, COLOR_NAME_764, COLOR_NAME_765, COLOR_NAME_766, COLOR_NAME_767,
+    COLOR_NAME_768, COLOR_NAME_769, COLOR_NAME_770, COLOR_NAME_771, COLOR_NAME_772, COLOR_NAME_773, COLOR_NAME_774, COLOR_NAME_775,
+    COLOR_NAME_776, COLOR_NAME_777, COLOR_NAME_778, COLOR_NAME_779, COLOR_NAME_780, COLOR_NAME_781, COLOR_NAME_782, COLOR_NAME_783,
+    COLOR_NAME_784, COLOR_NAME_785, COLOR_NAME_786, COLOR_NAME_787, COLOR_NAME_788, COLOR_NAME_789, COLOR_NAME_790, COLOR_NAME_791,
+    COLOR_NAME_792, COLOR_NAME_793, COLOR_NAME_794, COLOR_NAME_795, COLOR_NAME_796, COLOR_NAME_797, COLOR_NAME_798, COLOR_NAME_799,
+    COLOR_NAME_800, COLOR_NAME_801, COLOR_NAME_802, COLOR_NAME_803, COLOR_NAME_804, COLOR_NAME_805, COLOR_NAME_806, COLOR_NAME_807,
+    COLOR_NAME_808, COLOR_NAME_809, COLOR_NAME_810, COLOR_NAME_811, COLOR_NAME_812, COLOR_NAME_813, COLOR_NAME_814, COLOR_NAME_815,
+    COLOR_NAME_816, COLOR_NAME_817, COLOR_NAME_818, COLOR_NAME_819, COLOR_NAME_820, COLOR_NAME_821, COLOR_NAME_822, COLOR_NAME_823,
+    COLOR_NAME_824, COLOR_NAME_825, COLOR_NAME_826, COLOR_NAME_827, COLOR_NAME_828, COLOR_NAME_829, COLOR_NAME_830, COLOR_NAME_831,
+    COLOR_NAME_832, COLOR_NAME_833, COLOR_NAME_834, COLOR_NAME_835, COLOR_NAME_836, COLOR_NAME_837, COLOR_NAME_838, COLOR_NAME_839,
+    COLOR_NAME_840, COLOR_NAME_841, COLOR_NAME_842, COLOR_NAME_843, COLOR_NAME_844, COLOR_NAME_845, COLOR_NAME_846, COLOR_NAME_847,
+    COLOR_NAME_848, COLOR_NAME_849, COLOR_NAME_850, COLOR_NAME_851, COLOR_NAME_852, COLOR_NAME_853, COLOR_NAME_854, COLOR_NAME_855,
+    COLOR_NAME_856, COLOR_NAME_857, COLOR_NAME_858, COLOR_NAME_859, COLOR_NAME_860, COLOR_NAME_861, COLOR_NAME_862, COLOR_NAME_863,
+    COLOR_NAME_864,
+};
+
+static const uint8_t COLOR_RGB[][3] PROGMEM = {
+    {93,138,168}, {0,48,143}, {114,160,193}, {163,38,56}, {240,248,255}, {227,38,54}, {196,98,16}, {239,222,205},
+    {229,43,80}, {255,191,0}, {255,126,0}, {255,3,62}, {153,102,204}, {164,198,57}, {242,243,244}, {205,149,117},
+    {145,92,131}, {132,27,45}, {250,235,215}, {0,128,0}, {141,182,0}, {251,206,177}, {0,255,255}, {127,255,212},
+    {75,83,32}, {59,68,75}, {233,214,107}, {178,190,181}, {135,169,107}, {255,153,102}, {165,42,42}, {253,238,0},
+    {110,127,128}, {86,130,3}, {0,127,255}, {240,255,255}, {137,207,240}, {161,202,241}, {244,194,194}, {33,171,205},
+    {250,231,181}, {255,225,53}, {124,10,2}, {132,132,130}, {152,119,123}, {188,212,230}, {159,129,112}, {245,245,220},
+    {156,37,66}, {255,228,196}, {61,43,31}, {254,111,94}, {191,79,81}, {0,0,0}, {61,12,2}, {37,53,41},
+    {59,60,54}, {255,235,205}, {165,113,100}, {49,140,231}, {172,229,238}, {250,240,190}, {0,0,255}, {162,162,208},
+    {31,117,254}, {102,153,204}, {13,152,186}, {0,147,175}, {0,135,189}, {51,51,153}, {2,71,254}, {18,97,128},
+    {138,43,226}, {222,93,131}, {121,68,59}, {0,149,182}, {227,218,201}, {204,0,0}, {0,106,78}, {135,50,96},
+    {0,112,255}, {181,166,66}, {203,65,84}, {29,172,214}, {102,255,0}, {191,148,228}, {195,33,72}, {255,0,127},
+    {8,232,222}, {209,159,232}, {244,187,255}, {255,85,163}, {251,96,127}, {0,66,37}, {205,127,50}, {150,75,0},
+    {165,42,42}, {255,193,204}, {231,254,255}, {240,220,130}, {72,6,7}, {128,0,32}, {222,184,135}, {204,85,0},
+    {233,116,81}, {138,51,36}, {189,51,164}, {112,41,99}, {83,104,114}, {95,158,160}, {145,163,176}, {0,107,60},
+    {237,135,45}, {227,0,34}, {255,246,0}, {166,123,91}, {75,54,33}, {30,77,43}, {163,193,173}, {193,154,107},
+    {239,187,204}, {120,134,107}, {255,239,0}, {255,8,0}, {228,113,122}, {0,191,255}, {89,39,32}, {196,30,58},
+    {0,204,153}, {150,0,24}, {215,0,64}, {235,76,66}, {255,0,56}, {255,166,201}, {179,27,27}, {153,186,221},
+    {237,145,33}, {6,42,120}, {146,161,207}, {172,225,175}, {0,123,167}, {47,132,124}, {178,255,255}, {73,151,208},
+    {222,49,99}, {236,59,131}, {0,123,167}, {42,82,190}, {109,155,195}, {0,122,165}, {224,60,49}, {160,120,90},
+    {250,214,165}, {54,69,79}, {230,143,172}, {223,255,0}, {127,255,0}, {222,49,99}, {255,183,197}, {205,92,92},
+    {222,111,161}, {168,81,110}, {170,56,30}, {123,63,0}, {210,105,30}, {255,167,0}, {152,129,123}, {227,66,52},
+    {210,105,30}, {228,208,10}, {251,204,231}, {0,71,171}, {210,105,30}, {111,78,55}, {155,221,255}, {248,131,121},
+    {0,46,99}, {140,146,172}, {184,115,51}, {218,138,103}, {173,111,105}, {203,109,81}, {153,102,102}, {255,56,0},
+    {255,127,80}, {248,131,121}, {255,64,64}, {137,63,69}, {251,236,93}, {179,27,27}, {100,149,237}, {255,248,220},
+    {255,248,231}, {255,188,217}, {255,253,208}, {220,20,60}, {190,0,50}, {0,255,255}, {0,183,235}, {255,255,49},
+    {240,225,48}, {0,0,139}, {101,67,33}, {93,57,84}, {164,0,0}, {8,69,126}, {152,105,96}, {205,91,69},
+    {0,139,139}, {83,104,120}, {184,134,11}, {169,169,169}, {1,50,32}, {0,65,106}, {26,36,33}, {189,183,107},
+    {72,60,50}, {115,79,150}, {139,0,139}, {0,51,102}, {85,107,47}, {255,140,0}, {153,50,204}, {119,158,203},
+    {3,192,60}, {150,111,214}, {194,59,34}, {231,84,128}, {0,51,153}, {135,38,87}, {139,0,0}, {233,150,122},
+    {86,3,25}, {143,188,143}, {60,20,20}, {72,61,139}, {47,79,79}, {23,114,69}, {145,129,81}, {255,168,18},
+    {72,60,50}, {204,78,92}, {0,206,209}, {148,0,211}, {155,135,12}, {0,112,60}, {85,85,85}, {215,10,83},
+    {169,32,62}, {239,48,56}, {233,105,44}, {218,50,135}, {250,214,165}, {185,78,72}, {112,66,65}, {193,84,193},
+    {0,75,73}, {153,85,187}, {204,0,204}, {255,203,164}, {255,20,147}, {132,63,91}, {255,153,51}, {0,191,255},
+    {102,66,77}, {21,96,189}, {193,154,107}, {237,201,175}, {105,105,105}, {30,144,255}, {215,24,104}, {133,187,101},
+    {150,113,23}, {0,0,156}, {225,169,95}, {85,93,80}, {194,178,128}, {97,64,81}, {240,234,214}, {16,52,166},
+    {125,249,255}, {255,0,63}, {0,255,255}, {0,255,0}, {111,0,255}, {244,187,255}, {204,255,0}, {191,0,255},
+    {63,0,255}, {143,0,255}, {255,255,0}, {80,200,120}, {180,131,149}, {150,200,162}, {193,154,107}, {128,24,24},
+    {181,51,137}, {244,0,161}, {229,170,112}, {77,93,83}, {79,121,66}, {255,40,0}, {108,84,30}, {206,32,41},
+    {178,34,34}, {226,88,34}, {252,142,172}, {247,233,142}, {238,220,130}, {255,250,240}, {255,191,0}, {255,20,147},
+    {204,255,0}, {255,0,79}, {1,68,33}, {34,139,34}, {166,123,91}, {0,114,187}, {134,96,142}, {204,255,0},
+    {199,44,72}, {246,74,138}, {255,0,255}, {193,84,193}, {255,119,255}, {199,67,117}, {228,132,0}, {204,102,102},
+    {220,220,220}, {228,155,15}, {248,248,255}, {176,101,0}, {96,130,182}, {230,232,250}, {212,175,55}, {255,215,0},
+    {153,101,21}, {252,194,0}, {255,223,0}, {218,165,32}, {168,228,160}, {128,128,128}, {70,89,69}, {128,128,128},
+    {190,190,190}, {0,255,0}, {28,172,120}, {0,128,0}, {0,168,119}, {0,159,107}, {0,165,80}, {102,176,50},
+    {173,255,47}, {169,154,134}, {0,255,127}, {102,56,84}, {68,108,207}, {82,24,250}, {233,214,107}, {63,255,0},
+    {201,0,22}, {218,145,0}, {128,128,0}, {223,115,255}, {244,0,161}, {240,255,240}, {0,127,191}, {73,121,107},
+    {255,29,206}, {255,105,180}, {53,94,59}, {113,166,210}, {252,247,94}, {0,35,149}, {178,236,93}, {19,136,8},
+    {205,92,92}, {227,168,87}, {111,0,255}, {0,65,106}, {75,0,130}, {0,47,167}, {255,79,0}, {186,22,12},
+    {192,54,44}, {90,79,207}, {244,240,236}, {0,144,0}, {255,255,240}, {0,168,107}, {248,222,126}, {215,59,62},
+    {165,11,94}, {52,52,52}, {250,218,94}, {189,218,87}, {41,171,135}, {76,187,23}, {124,28,5}, {195,176,145},
+    {240,230,140}, {232,0,13}, {8,120,48}, {214,202,221}, {38,97,156}, {254,254,34}, {169,186,157}, {207,16,32},
+    {204,204,255}, {255,240,245}, {181,126,220}, {196,195,208}, {148,87,235}, {238,130,238}, {230,230,250}, {251,174,210},
+    {150,123,182}, {251,160,227}, {230,230,250}, {124,252,0}, {255,247,0}, {255,250,205}, {227,255,0}, {26,17,16},
+    {253,213,177}, {173,216,230}, {181,101,29}, {230,103,113}, {240,128,128}, {147,204,234}, {245,105,145}, {224,255,255},
+    {249,132,239}, {250,250,210}, {211,211,211}, {144,238,144}, {240,230,140}, {177,156,217}, {255,182,193}, {233,116,81},
+    {255,160,122}, {255,153,153}, {32,178,170}, {135,206,250}, {119,136,153}, {179,139,109}, {230,143,172}, {255,255,224},
+    {200,162,200}, {191,255,0}, {50,205,50}, {0,255,0}, {157,194,9}, {25,89,5}, {250,240,230}, {193,154,107},
+    {108,160,220}, {83,75,79}, {230,32,32}, {255,0,255}, {202,31,123}, {255,0,144}, {170,240,209}, {248,244,255},
+    {192,64,0}, {251,236,93}, {96,80,220}, {11,218,81}, {151,154,170}, {255,130,67}, {116,195,101}, {136,0,133},
+    {195,33,72}, {128,0,0}, {176,48,96}, {224,176,255}, {145,95,109}, {239,152,170}, {115,194,251}, {229,183,59},
+    {102,221,170}, {0,0,205}, {226,6,44}, {175,64,53}, {243,229,171}, {3,80,150}, {28,53,45}, {221,160,221},
+    {186,85,211}, {0,103,165}, {147,112,219}, {187,51,133}, {170,64,105}, {60,179,113}, {123,104,238}, {201,220,135},
+    {0,250,154}, {103,76,71}, {72,209,204}, {121,68,59}, {217,96,59}, {199,21,133}, {248,184,120}, {248,222,126},
+    {253,188,180}, {25,25,112}, {0,73,83}, {255,196,12}, {62,180,137}, {245,255,250}, {152,255,152}, {255,228,225},
+    {250,235,215}, {150,113,23}, {115,169,194}, {174,12,0}, {173,223,173}, {48,186,143}, {153,122,141}, {24,69,59},
+    {197,75,140}, {255,219,88}, {33,66,30}, {246,173,198}, {42,128,0}, {250,218,94}, {255,222,173}, {0,0,128},
+    {255,163,67}, {254,65,100}, {57,255,20}, {215,131,127}, {164,221,237}, {5,144,51}, {0,119,190}, {204,119,34},
+    {0,128,0}, {207,181,59}, {253,245,230}, {121,104,120}, {103,49,71}, {192,128,129}, {128,128,0}, {60,52,31},
+    {107,142,35}, {154,185,115}, {53,56,57}, {183,132,167}, {255,127,0}, {255,159,0}, {255,69,0}, {251,153,2},
+    {255,165,0}, {218,112,214}, {101,67,33}, {153,0,0}, {65,74,76}, {255,110,74}, {0,33,71}, {0,102,0},
+    {39,59,226}, {104,40,96}, {188,212,230}, {175,238,238}, {152,118,84}, {175,64,53}, {155,196,226}, {221,173,175},
+    {218,138,103}, {171,205,239}, {230,190,138}, {238,232,170}, {152,251,152}, {220,208,255}, {249,132,229}, {250,218,221},
+    {221,160,221}, {219,112,147}, {150,222,209}, {201,192,187}, {236,235,189}, {188,152,126}, {219,112,147}, {120,24,74},
+    {255,239,213}, {80,200,120}, {174,198,207}, {131,105,83}, {207,207,196}, {119,221,119}, {244,154,194}, {255,179,71},
+    {222,165,164}, {179,158,181}, {255,105,97}, {203,153,201}, {253,253,150}, {128,0,128}, {83,104,120}, {255,229,180},
+    {255,203,164}, {255,204,153}, {255,218,185}, {250,223,173}, {209,226,49}, {234,224,200}, {136,216,192}, {183,104,162},
+    {230,226,0}, {204,204,255}, {28,57,187}, {0,166,147}, {50,18,122}, {217,144,88}, {247,127,190}, {112,28,28},
+    {204,51,51}, {254,40,162}, {236,88,0}, {205,133,63}, {223,0,255}, {0,15,137}, {18,53,36}, {253,221,230},
+    {1,121,111}, {255,192,203}, {255,221,244}, {255,153,102}, {231,172,207}, {247,143,167}, {147,197,114}, {229,228,226},
+    {142,69,133}, {221,160,221}, {255,90,54}, {176,224,230}, {255,143,0}, {112,28,28}, {0,49,83}, {223,0,255},
+    {204,136,153}, {255,117,24}, {105,53,156}, {128,0,128}, {150,120,182}, {159,0,197}, {254,78,218}, {80,64,77},
+    {160,32,240}, {81,72,79}, {93,138,168}, {255,53,94}, {251,171,96}, {227,11,93}, {145,95,109}, {226,80,152},
+    {179,68,108}, {130,102,68}, {255,51,204}, {227,37,107}, {255,0,0}, {165,42,42}, {134,1,17}, {242,0,60},
+    {196,2,51}, {255,83,73}, {237,28,36}, {254,39,18}, {199,21,133}, {171,78,82}, {82,45,128}, {0,35,135},
+    {0,64,64}, {241,167,254}, {215,0,64}, {8,146,208}, {167,107,207}, {182,102,210}, {176,48,96}, {65,72,51},
+    {0,204,204}, {255,0,127}, {249,66,158}, {103,72,70}, {183,110,121}, {227,38,54}, {255,102,204}, {170,152,169},
+    {144,93,93}, {171,78,82}, {101,0,11}, {212,0,0}, {188,143,143}, {0,56,168}, {0,35,102}, {65,105,225},
+    {202,44,146}, {120,81,169}, {250,218,94}, {209,0,86}, {224,17,95}, {155,17,30}, {255,0,40}, {187,101,40},
+    {225,142,150}, {168,28,7}, {128,70,27}, {183,65,14}, {218,44,67}, {0,86,63}, {139,69,19}, {255,103,0},
+    {244,196,48}, {255,140,105}, {255,145,164}, {194,178,128}, {150,113,23}, {236,213,64}, {244,164,96}, {150,113,23},
+    {146,0,10}, {80,125,42}, {15,82,186}, {0,103,165}, {203,161,53}, {255,36,0}, {253,14,53}, {255,216,0},
+    {118,255,122}, {0,105,148}, {46,139,87}, {50,20,20}, {255,245,238}, {255,186,0}, {112,66,20}, {138,121,93},
+    {0,158,96}, {252,15,192}, {255,111,255}, {136,45,23}, {192,192,192}, {203,65,11}, {0,116,116}, {135,206,235},
+    {207,113,175}, {106,90,205}, {112,128,144}, {0,51,153}, {147,61,65}, {16,12,8}, {255,250,250}, {15,192,252},
+    {167,252,0}, {0,255,127}, {35,41,122}, {70,130,180}, {250,218,94}, {153,0,0}, {79,102,106}, {228,217,111},
+    {255,204,51}, {250,214,165}, {210,180,140}, {249,77,0}, {242,133,0}, {255,204,0}, {228,113,122}, {72,60,50},
+    {139,133,137}, {208,240,192}, {248,131,121}, {244,194,194}, {0,128,128}, {54,117,136}, {0,130,127}, {207,52,118},
+    {205,87,0}, {226,114,91}, {216,191,216}, {222,111,161}, {252,137,172}, {10,186,181}, {224,141,60}, {219,215,210},
+    {238,230,0}, {255,99,71}, {116,108,192}, {255,200,124}, {253,14,53}, {128,128,128}, {0,117,94}, {0,115,207},
+    {65,125,193}, {222,170,136}, {181,114,129}, {48,213,200}, {0,255,239}, {160,214,180}, {124,72,72}, {138,73,107},
+    {102,2,60}, {0,51,170}, {217,0,76}, {136,120,195}, {83,104,149}, {255,179,0}, {60,208,112}, {255,111,255},
+    {18,10,143}, {65,102,245}, {99,81,71}, {255,221,202}, {91,146,229}, {183,135,39}, {255,255,102}, {1,68,33},
+    {123,17,19}, {174,32,41}, {225,173,33}, {0,79,152}, {153,0,0}, {255,204,0}, {211,0,63}, {243,229,171},
+    {197,179,88}, {200,8,21}, {67,179,174}, {227,66,52}, {217,96,59}, {160,32,240}, {143,0,255}, {50,74,178},
+    {127,0,255}, {134,1,175}, {238,130,238}, {64,130,109}, {146,39,36}, {159,29,53}, {218,29,129}, {255,160,137},
+    {159,0,255}, {0,66,66}, {164,244,249}, {100,84,82}, {245,222,179}, {255,255,255}, {245,245,245}, {162,173,208},
+    {255,67,164}, {252,108,133}, {114,47,55}, {103,49,71}, {201,160,220}, {193,154,107}, {115,134,120}, {15,77,146},
+    {255,255,0}, {154,205,50}, {239,204,0}, {255,211,0}, {255,174,66}, {255,239,0}, {254,254,51}, {0,20,168},
+    {44,22,8},
+};
+
+static const uint8_t COLOR_NAME_SEEDS[COLOR_NAMES_BUCKETS] PROGMEM = {
+    7, 2, 5, 1, 7, 4, 5, 33, 1, 3, 12, 23, 4, 58, 1, 1,
+    25, 5, 1, 8, 5, 6, 32, 2, 9, 5, 30, 0, 6, 1, 26, 6,
+    2, 8, 1, 8, 10, 5, 2, 3, 5, 4, 6, 5, 1, 5, 2, 13,
+    11, 7, 2, 7, 45, 1, 9, 2, 11, 3, 1, 8, 70, 1, 9, 3,
+    19, 3, 11, 10, 13, 13, 13, 6, 4, 5, 2, 1, 3, 17, 5, 28,
+    6, 6, 29, 13, 5, 1, 15, 4, 2, 2, 12, 25, 5, 1, 8, 24,
+    2, 3, 1, 2, 6, 3, 2, 4, 8, 4, 1, 9, 11, 1, 11, 12,
+    15, 34, 6, 6, 1, 1, 1, 3, 2, 3, 6, 1, 1, 1, 12, 26,
+    18, 1, 7, 1, 1, 19, 4, 2, 29, 2, 7, 19, 3, 6, 18, 1,
+    3, 5, 5, 6, 2, 0, 8, 7, 5, 4, 6, 14, 8, 74, 0, 37,
+    2, 4, 19, 68, 12, 2, 48, 43, 6, 1, 55, 7, 3, 35, 35, 13,
+    25, 4, 22, 3, 1, 37, 0, 1, 1, 30, 3, 3, 3, 2, 31, 1,
+    30, 6, 4, 9, 8, 0, 12, 4, 8, 1, 8, 27, 0, 1, 9, 1,
+    6, 36, 1, 3, 8, 23, 9, 14, 7, 3, 42, 3, 11, 4, 2, 1,
+    1, 22, 19, 1, 4, 11, 7, 16, 56, 39, 43, 134, 26, 1, 2, 5,
+    2, 1, 5, 88, 9, 11, 3, 14, 3, 48, 5, 5, 9, 2, 11, 4,
+};
+
+static const uint16_t COLOR_NAME_SLOTS[COLOR_NAMES_SLOTS] PROGMEM = {
+    490, 256, 263, 755, 544, 815, 65535, 424, 342, 65535, 153, 641, 407, 18, 46, 307,
+    65535, 576, 242, 477, 772, 637, 561, 505, 607, 665, 213, 351, 65535, 503, 181, 726,
+    211, 449, 514, 766, 420, 65535, 348, 583, 829, 454, 434, 757, 305, 577, 99, 65535,
+    524, 823, 363, 535, 297, 600, 629, 109, 20, 331, 468, 289, 487, 230, 614, 832,
+    707, 65535, 513, 703, 65535, 133, 57, 539, 462, 65535, 60, 495, 645, 627, 738, 119,
+    380, 601, 158, 740, 65535, 779, 594, 65535, 65535, 427, 592, 460, 65535, 325, 715, 105,
+    65535, 419, 763, 732, 863, 515, 192, 373, 723, 507, 39, 65535, 65535, 491, 860, 704,
+    203, 367, 864, 65535, 550, 292, 324, 293, 239, 30, 375, 65535, 180, 761, 140, 65535,
+    536, 565, 65535, 260, 45, 65535, 205, 404, 65535, 231, 701, 84, 683, 725, 480, 570,
+    201, 800, 65535, 546, 65535, 474, 737, 445, 534, 172, 32, 93, 95, 842, 684, 532,
+    857, 272, 433, 814, 65535, 644, 126, 65535, 501, 705, 398, 118, 251, 65535, 463, 42,
+    227, 88, 442, 676, 846, 65535, 432, 65535, 65535, 65535, 236, 572, 672, 65535, 59, 249,
+    65535, 160, 65535, 22, 357, 686, 65535, 171, 853, 96, 542, 195, 666, 303, 559, 65535,
+    82, 94, 393, 639, 221, 786, 65535, 103, 271, 635, 827, 65535, 421, 619, 65535, 240,
+    65535, 605, 405, 141, 179, 630, 269, 345, 613, 364, 169, 750, 65535, 356, 379, 488,
+    56, 65535, 112, 528, 65535, 589, 669, 675, 80, 816, 640, 500, 745, 711, 104, 573,
+    65535, 818, 847, 690, 851, 634, 315, 828, 509, 731, 410, 90, 65535, 359, 381, 426,
+    270, 780, 365, 416, 710, 65535, 587, 13, 216, 4, 612, 516, 521, 409, 65535, 808,
+    117, 470, 471, 794, 73, 523, 451, 418, 323, 498, 511, 655, 708, 65535, 199, 309,
+    527, 91, 392, 319, 374, 855, 360, 824, 34, 558, 113, 97, 567, 402, 308, 335,
+    1, 238, 680, 721, 115, 764, 850, 202, 65535, 788, 466, 71, 674, 24, 65535, 332,
+    485, 777, 663, 762, 29, 65535, 65535, 469, 768, 190, 385, 318, 65535, 618, 15, 603,
+    334, 65535, 467, 110, 713, 820, 159, 543, 387, 841, 422, 178, 51, 413, 65535, 65535,
+    65535, 568, 735, 647, 423, 789, 206, 65535, 394, 697, 845, 285, 218, 817, 791, 5,
+    831, 65535, 722, 525, 390, 563, 279, 314, 124, 399, 431, 182, 631, 65535, 247, 623,
+    339, 632, 302, 596, 290, 28, 562, 389, 65535, 65535, 656, 65535, 217, 552, 19, 65535,
+    65535, 396, 278, 773, 65535, 856, 89, 0, 152, 578, 313, 98, 642, 65535, 25, 626,
+    754, 65535, 709, 728, 508, 714, 336, 657, 443, 395, 702, 582, 571, 604, 65535, 774,
+    264, 412, 268, 439, 246, 306, 222, 590, 136, 494, 673, 237, 650, 67, 65535, 65535,
+    417, 397, 564, 69, 65535, 37, 799, 330, 65535, 844, 129, 633, 482, 122, 295, 127,
+    585, 173, 12, 819, 479, 253, 223, 235, 358, 497, 695, 294, 83, 65535, 333, 283,
+    288, 376, 438, 150, 667, 435, 128, 75, 243, 341, 681, 174, 456, 452, 530, 275,
+    65535, 526, 353, 622, 212, 326, 648, 102, 65535, 65535, 65535, 65535, 166, 756, 100, 448,
+    858, 804, 811, 825, 659, 751, 771, 692, 382, 595, 436, 78, 457, 549, 506, 65535,
+    183, 517, 320, 65535, 224, 793, 767, 229, 187, 204, 461, 70, 65535, 484, 86, 53,
+    414, 198, 139, 834, 65535, 63, 636, 662, 252, 792, 266, 361, 23, 388, 65535, 177,
+    164, 38, 65535, 65535, 65535, 65535, 406, 65535, 322, 678, 685, 769, 688, 228, 651, 43,
+    116, 65535, 134, 401, 522, 186, 65535, 741, 65535, 248, 830, 809, 797, 44, 499, 321,
+    175, 444, 700, 344, 783, 403, 135, 48, 537, 327, 483, 638, 65535, 489, 660, 693,
+    36, 661, 65535, 65535, 765, 425, 65535, 608, 785, 689, 226, 310, 280, 481, 343, 776,
+    340, 185, 76, 65535, 621, 299, 65535, 586, 54, 301, 580, 101, 378, 591, 531, 557,
+    220, 244, 440, 386, 843, 545, 628, 281, 718, 61, 859, 760, 66, 368, 65535, 615,
+    65535, 125, 625, 65535, 47, 574, 575, 782, 254, 197, 145, 624, 317, 300, 10, 355,
+    749, 698, 106, 65535, 74, 384, 540, 148, 518, 209, 64, 349, 65535, 593, 609, 533,
+    65535, 245, 65535, 114, 87, 833, 156, 753, 437, 383, 547, 312, 65535, 170, 821, 806,
+    566, 337, 65535, 65535, 694, 65535, 658, 65535, 802, 551, 107, 569, 137, 752, 215, 257,
+    208, 812, 652, 65, 787, 65535, 584, 836, 168, 65535, 781, 154, 258, 52, 677, 65535,
+    142, 556, 734, 758, 778, 464, 486, 616, 65535, 65535, 65535, 826, 65535, 620, 504, 65535,
+    720, 653, 8, 611, 85, 369, 770, 165, 354, 77, 759, 597, 696, 81, 65535, 328,
+    687, 862, 11, 450, 670, 296, 747, 316, 338, 455, 502, 668, 784, 411, 350, 65535,
+    736, 21, 9, 210, 541, 492, 72, 241, 276, 796, 261, 430, 65535, 111, 837, 795,
+    861, 352, 234, 65535, 17, 712, 810, 65535, 746, 371, 65535, 840, 123, 219, 250, 65535,
+    730, 441, 35, 284, 849, 157, 287, 65535, 548, 108, 682, 801, 298, 458, 679, 7,
+    65535, 49, 599, 282, 3, 65535, 555, 311, 790, 286, 496, 65535, 372, 194, 132, 671,
+    839, 65535, 716, 560, 65535, 65535, 742, 65535, 400, 255, 520, 838, 259, 267, 149, 65535,
+    598, 130, 329, 58, 803, 65535, 147, 602, 304, 476, 26, 473, 646, 79, 65535, 465,
+    366, 346, 40, 391, 121, 262, 31, 553, 805, 131, 579, 188, 14, 807, 265, 65535,
+    529, 699, 65535, 475, 347, 554, 581, 493, 207, 200, 191, 65535, 162, 724, 706, 41,
+    588, 196, 225, 65535, 65535, 184, 377, 65535, 729, 277, 519, 510, 65535, 748, 16, 798,
+    447, 65535, 453, 512, 852, 538, 854, 274, 33, 92, 478, 65535, 717, 161, 143, 835,
+    65535, 163, 291, 822, 617, 65535, 739, 610, 370, 151, 743, 189, 146, 65535, 664, 65535,
+    408, 214, 144, 415, 6, 62, 654, 273, 2, 27, 472, 429, 649, 362, 65535, 643,
+    65535, 65535, 775, 55, 138, 813, 691, 848, 65535, 428, 167, 459, 65535, 193, 65535, 727,
+    446, 606, 719, 744, 155, 65535, 176, 120, 65535, 233, 50, 232, 68, 65535, 65535, 733,
+};
+
+// Nearest color k-d tree, node of [lo,hi) is (lo+hi)/2: color id | split axis << 14
+static const uint16_t COLOR_KD_TREE[COLOR_NAMES_COUNT] PROGMEM = {
+    53, 17133, 423, 864, 100, 16438, 33002, 731, 32982, 558, 50, 232, 16510, 16596, 622, 33254,
+    672, 55, 393, 16930, 56, 543, 32884, 216, 33008, 767, 33415, 277, 690, 42, 473, 230,
+    555, 33488, 33430, 129, 17200, 295, 32869, 800, 16967, 16401, 398, 33383, 637, 17123, 163, 32873,
+    33604, 540, 851, 850, 187, 748, 16477, 314, 33583, 519, 117, 522, 679, 16408, 559, 33221,
+    402, 33138, 111, 16629, 33477, 841, 33024, 506, 153, 25, 16940, 16620, 78, 237, 342, 299,
+    16684, 649, 734, 710, 95, 33474, 202, 554, 16686, 220, 272, 513, 716, 336, 17103, 32941,
+    254, 74, 499, 33451, 264, 798, 16841, 497, 17194, 17227, 275, 657, 757, 204, 17204, 515,
+    825, 77, 33128, 17085, 705, 33151, 134, 32957, 304, 33585, 303, 691, 123, 660, 33169, 113,
+    702, 16791, 725, 16685, 33435, 666, 16842, 32798, 196, 822, 130, 17048, 837, 247, 16511, 96,
+    32771, 248, 32816, 86, 472, 674, 802, 663, 11, 132, 281, 33081, 16866, 726, 788, 16579,
+    5, 685, 17045, 464, 33509, 707, 32930, 226, 33152, 616, 183, 16934, 763, 32918, 167, 827,
+    33251, 320, 16949, 253, 17053, 689, 52, 391, 708, 32776, 16633, 186, 16515, 16766, 103, 17160,
+    6, 16715, 426, 16919, 164, 618, 33479, 305, 16552, 172, 641, 33471, 500, 33596, 207, 16565,
+    178, 104, 250, 634, 33433, 17169, 439, 557, 33355, 527, 32969, 808, 17005, 505, 33439, 17078,
+    638, 32944, 219, 32905, 1, 754, 612, 597, 17027, 229, 33148, 471, 32986, 16945, 203, 355,
+    32847, 107, 33438, 16619, 213, 33147, 205, 71, 758, 32876, 16593, 790, 33392, 742, 773, 598,
+    16751, 246, 261, 33567, 632, 16400, 688, 33244, 17038, 268, 735, 33307, 318, 16428, 206, 392,
+    699, 700, 653, 87, 681, 16885, 474, 270, 659, 33228, 668, 838, 17062, 82, 33260, 325,
+    33543, 296, 491, 251, 144, 651, 32925, 529, 32913, 17040, 182, 241, 327, 32929, 520, 17068,
+    16564, 564, 151, 115, 32826, 518, 794, 159, 376, 33195, 92, 32995, 321, 16457, 16978, 777,
+    51, 32892, 766, 849, 33229, 273, 17247, 373, 16765, 228, 69, 17131, 801, 17077, 171, 855,
+    279, 642, 33601, 481, 32830, 288, 284, 378, 832, 16741, 610, 32838, 560, 831, 72, 16601,
+    819, 16873, 723, 17113, 149, 33085, 485, 404, 33490, 265, 147, 697, 17188, 33302, 791, 695,
+    356, 33577, 80, 64, 385, 745, 33234, 16878, 786, 17187, 289, 645, 258, 297, 364, 260,
+    33505, 16695, 696, 32874, 222, 682, 617, 17232, 33426, 243, 287, 620, 639, 322, 459, 17214,
+    840, 368, 17032, 829, 646, 17039, 257, 255, 323, 16991, 644, 744, 577, 430, 32859, 369,
+    16544, 582, 33547, 32780, 412, 677, 488, 17060, 225, 33258, 553, 686, 33092, 33131, 738, 807,
+    16524, 19, 16731, 387, 536, 524, 33, 33143, 533, 315, 721, 33118, 736, 730, 351, 362,
+    33310, 544, 244, 210, 33581, 32849, 121, 238, 316, 16503, 28, 266, 33117, 772, 17158, 208,
+    16995, 389, 33116, 346, 835, 32800, 746, 16525, 396, 854, 341, 343, 166, 46, 33557, 43,
+    33536, 353, 445, 16965, 33309, 292, 17076, 294, 326, 10, 548, 17148, 221, 17020, 16745, 329,
+    551, 549, 16936, 165, 33007, 33107, 94, 16496, 136, 33550, 619, 469, 16646, 724, 16718, 818,
+    528, 17244, 32952, 613, 32947, 15, 568, 713, 16413, 32943, 531, 428, 185, 17154, 231, 33472,
+    17011, 455, 853, 274, 377, 718, 17036, 33066, 276, 33167, 793, 440, 33607, 17099, 224, 397,
+    20, 16834, 419, 33235, 16468, 283, 345, 451, 530, 359, 156, 33039, 493, 33276, 517, 291,
+    470, 33001, 16969, 354, 753, 806, 589, 17112, 435, 452, 33625, 13, 16553, 752, 33372, 16539,
+    286, 312, 319, 33190, 449, 33120, 33305, 630, 215, 824, 33313, 762, 102, 17143, 395, 16758,
+    33263, 572, 16894, 479, 805, 17117, 9, 16694, 337, 33275, 17096, 858, 765, 821, 17243, 335,
+    17111, 16722, 608, 16415, 122, 16498, 420, 16674, 33552, 861, 17240, 33173, 200, 16583, 33528, 591,
+    17101, 394, 16909, 521, 33466, 33524, 502, 16954, 787, 16410, 358, 32867, 16692, 862, 32809, 188,
+    33233, 372, 17198, 33158, 503, 33168, 16820, 307, 16980, 32896, 146, 32836, 366, 755, 0, 650,
+    16451, 75, 16450, 781, 442, 109, 17210, 33560, 675, 32802, 269, 59, 143, 33580, 16423, 83,
+    32966, 33519, 125, 263, 332, 416, 16828, 177, 17071, 2, 468, 32916, 65, 33224, 190, 223,
+    138, 63, 16494, 211, 16790, 293, 32886, 514, 586, 33615, 371, 135, 16862, 566, 32805, 437,
+    547, 17024, 593, 154, 446, 16861, 590, 441, 33482, 629, 33074, 780, 33382, 16976, 27, 33112,
+    740, 579, 567, 16651, 38, 523, 16822, 16542, 504, 33539, 33216, 410, 16469, 595, 16473, 852,
+    487, 576, 413, 834, 432, 16958, 633, 417, 16517, 628, 16504, 411, 415, 625, 16481, 33546,
+    193, 33441, 32858, 475, 16669, 16787, 680, 16626, 496, 795, 480, 33266, 32791, 22, 197, 282,
+    796, 88, 280, 443, 340, 33565, 606, 33230, 578, 33197, 33511, 36, 569, 16558, 532, 17226,
+    60, 588, 16900, 139, 769, 571, 33348, 33373, 434, 783, 76, 33096, 45, 631, 33193, 408,
+    16946, 635, 609, 573, 16798, 16802, 563, 16526, 431, 333, 16482, 7, 601, 33027, 600, 16536,
+    252, 761, 33294, 21, 16808, 603, 33612, 602, 33579, 16433, 484, 33591, 599, 32808, 61, 32825,
+    33189, 278, 18, 16968, 433, 16578, 33280, 170, 16959, 623, 17010, 511, 16770, 16793, 47, 33222,
+    538, 33500, 14, 33231, 17230, 191, 33215, 192, 33077, 365, 388, 33277, 4, 16419, 330, 750,
+    17229,
+};
+
+#endif
\ No newline at end of file
@@ -0,0 +1,150 @@
+#include "compositor.h"
+
+#define LANES_LOW 0x00FF00FFUL
+#define HIGH_BITS 0x80808080UL
+
+/** Byte lane saturating add **/
+static inline uint32_t add_saturate(uint32_t a, uint32_t b)
+{
+    uint32_t sum = (a & ~HIGH_BITS) + (b & ~HIGH_BITS);
+    uint32_t high = (a ^ b) & HIGH_BITS;
+    // Lanes carrying out of bit 7
+    uint32_t carry = ((a & b) | (high & sum)) & HIGH_BITS;
+    return (sum ^ high) | ((carry >> 7) * 0xFF);
+}
+
+/** Max of the two 16 bit lanes holding a byte each **/
+static inline uint32_t max_lanes(uint32_t a, uint32_t b)
+{
+    // Bit 8 of each lane is set where a >= b
+    uint32_t ge = (((a | 0x01000100UL) - b) >> 8) & 0x00010001UL;
+    uint32_t mask = ge * 0xFF;
+    return (a & mask) | (b & ~mask & LANES_LOW);
+}
+
+/** a + (b - a) * alpha / 256 on two 16 bit lanes, alpha [0,256] **/
+static inline uint32_t alpha_lanes(uint32_t a, uint32_t b, uint16_t alpha)
+{
+    return ((a * (256 - alpha) + b * alpha) >> 8) & LANES_LOW;
+}
+
+/** Rounded a * b / 255 **/
+static inline uint8_t multiply8(uint8_t a, uint8_t b)
+{
+    uint16_t t = a * b + 128;
+    return (t + (t >> 8)) >> 8;
+}
+
+static inline uint32_t load32(const uint8_t *p)
+{
+    uint32_t v;
+    memcpy(&v, p, 4);
+    return v;
+}
+
+static inline void store32(uint8_t *p, uint32_t v)
+{
+    memcpy(p, &v, 4);
+}
+
+static inline uint8_t blend_byte(uint8_t a, uint8_t b, uint8_t mode)
+{
+    switch (mode)
+    {
+    case BLEND_ADD:
+        return a + b > 255 ? 255 : a + b;
+    case BLEND_MULTIPLY:
+        return multiply8(a, b);
+    case BLEND_SCREEN:
+        return 255 - multiply8(255 - a, 255 - b);
+    case BLEND_MAX:
+        return a > b ? a : b;
+    default:
+        return b;
+    }
+}
+
+void blend_frame(uint8_t *dst, const uint8_t *src, uint16_t bytes, uint8_t mode, uint16_t opacity)
+{
+    if (opacity == 0)
+        return;
+
+    uint16_t n = 0;
+    bool opaque = opacity >= OPACITY_MAX;
+
+    if (mode == BLEND_ALPHA || mode == BLEND_ADD || mode == BLEND_MAX)
+    {
+        for (; n + 4 <= bytes; n += 4)
+        {
+            uint32_t a = load32(dst + n);
+            uint32_t b = load32(src + n);
+            uint32_t out;
+            if (mode == BLEND_ADD)
+                out = add_saturate(a, b);
+            else if (mode == BLEND_MAX)
+                out = max_lanes(a & LANES_LOW, b & LANES_LOW) | (max_lanes((a >> 8) & LANES_LOW, (b >> 8) & LANES_LOW) << 8);
+            else
+                out = b;
+
+            if (!opaque)
+                out = alpha_lanes(a & LANES_LOW, out & LANES_LOW, opacity) | (alpha_lanes((a >> 8) & LANES_LOW, (out >> 8) & LANES_LOW, opacity) << 8);
+            store32(dst + n, out);
+        }
+    }
+
+    // Multiply and screen need a product per byte, and the tail of any mode
+    for (; n < bytes; n++)
+    {
+        uint8_t out = blend_byte(dst[n], src[n], mode);
+        dst[n] = opaque ? out : blend8(dst[n], out, opacity);
+    }
+}
+
+Compositor::Compositor(uint16_t pixels, uint8_t maxLayers)
+{
+    _pixels = pixels;
+    _maxLayers = maxLayers;
+    _count = 0;
+    _layers = new Layer *[maxLayers];
+    _scratch = new uint8_t[3 * pixels];
+}
+
+Compositor::~Compositor()
+{
+    delete[] _layers;
+    delete[] _scratch;
+}
+
+bool Compositor::add(Layer *layer)
+{
+    if (_count >= _maxLayers)
+        return false;
+    _layers[_count++] = layer;
+    return true;
+}
+
+void Compositor::compose(uint8_t *rgb, unsigned long now)
+{
+    bool first = true;
+    for (uint8_t n = 0; n < _count; n++)
+    {
+        Layer *layer = _layers[n];
+        if (!layer->enabled || layer->opacity == 0)
+            continue;
+
+        if (first && layer->opacity >= OPACITY_MAX)
+        {
+            layer->render(rgb, _pixels, now);
+        }
+        else
+        {
+            if (first)
+                memset(rgb, 0, 3 * _pixels);
+            layer->render(_scratch, _pixels, now);
+            blend_frame(rgb, _scratch, 3 * _pixels, first ? (uint8_t)BLEND_ALPHA : layer->mode, layer->opacity);
+        }
+        first = false;
+    }
+    if (first)
+        memset(rgb, 0, 3 * _pixels);
+}
@@ -0,0 +1,139 @@
+/*
+ * compositor.h
+ *
+ * Layered compositing of whole frames: each layer renders once per frame and
+ * is blended over the layers below with add, multiply, screen, alpha or max.
+ */
+
+#ifndef COMPOSITOR_H_
+#define COMPOSITOR_H_
+
+#include "Arduino.h"
+#include "rgb_utils.h"
+#include "color_animation.h"
+#include "rgb_transition.h"
+
+typedef enum
+{
+	/** Layer replaces what is below, with its opacity **/
+	BLEND_ALPHA,
+	/** Saturating addition **/
+	BLEND_ADD,
+	BLEND_MULTIPLY,
+	BLEND_SCREEN,
+	BLEND_MAX
+} BlendMode;
+
+#define OPACITY_MAX 256
+
+/** Blends @src over @dst, @bytes packed channel bytes, @opacity [0,256].
+ *  Works on 4 bytes per 32 bit word where the mode allows it.
+ **/
+void blend_frame(uint8_t *dst, const uint8_t *src, uint16_t bytes, uint8_t mode, uint16_t opacity = OPACITY_MAX);
+
+class Layer
+{
+public:
+	uint8_t mode;
+	/** [0,256] **/
+	uint16_t opacity;
+	bool enabled;
+
+	Layer(uint8_t blendMode = BLEND_ALPHA) : mode(blendMode), opacity(OPACITY_MAX), enabled(true) {}
+	virtual ~Layer() {}
+
+	/** Renders the frame, @rgb packed 3 bytes per pixel **/
+	virtual void render(uint8_t *rgb, uint16_t pixels, unsigned long now) = 0;
+
+protected:
+	static void fill(uint8_t *rgb, uint16_t pixels, RGBOutput color)
+	{
+		for (uint16_t n = 0; n < pixels; n++, rgb += 3)
+		{
+			rgb[0] = color.red;
+			rgb[1] = color.green;
+			rgb[2] = color.blue;
+		}
+	}
+};
+
+/** Single color layer **/
+class SolidLayer : public Layer
+{
+public:
+	RGBOutput color;
+
+	SolidLayer(RGBOutput c, uint8_t blendMode = BLEND_ALPHA) : Layer(blendMode), color(c) {}
+
+	virtual void render(uint8_t *rgb, uint16_t pixels, unsigned long /* now */) { fill(rgb, pixels, color); }
+};
+
+/** ColorAnimation evaluated once per frame and spread over all pixels **/
+class AnimationLayer : public Layer
+{
+public:
+	ColorAnimation &animation;
+
+	AnimationLayer(ColorAnimation &a, uint8_t blendMode = BLEND_ALPHA) : Layer(blendMode), animation(a) {}
+
+	virtual void render(uint8_t *rgb, uint16_t pixels, unsigned long /* now */)
+	{
+		if (animation.isAnimating())
+			animation.updateAnimation();
+		fill(rgb, pixels, animation.toRGB());
+	}
+};
+
+/** Per pixel transitions, pool size must match the pixel count **/
+template <uint16_t N>
+class TransitionLayer : public Layer
+{
+public:
+	RGBTransitionPool<N> &pool;
+
+	TransitionLayer(RGBTransitionPool<N> &p, uint8_t blendMode = BLEND_ALPHA) : Layer(blendMode), pool(p) {}
+
+	virtual void render(uint8_t *rgb, uint16_t /* pixels */, unsigned long now) { pool.update(now, rgb); }
+};
+
+/** Overlay drawn elsewhere, e.g. by IndexedPixels::expand() **/
+class BufferLayer : public Layer
+{
+public:
+	const uint8_t *buffer;
+
+	BufferLayer(const uint8_t *rgb, uint8_t blendMode = BLEND_ALPHA) : Layer(blendMode), buffer(rgb) {}
+
+	virtual void render(uint8_t *rgb, uint16_t pixels, unsigned long /* now */) { memcpy(rgb, buffer, 3 * pixels); }
+};
+
+class Compositor
+{
+
+protected:
+	Layer **_layers;
+	uint8_t _count;
+	uint8_t _maxLayers;
+	uint8_t *_scratch;
+	uint16_t _pixels;
+
+public:
+	Compositor(uint16_t pixels, uint8_t maxLayers = 4);
+	/** Owns its buffers, copies would free them twice **/
+	Compositor(const Compositor &) = delete;
+	Compositor &operator=(const Compositor &) = delete;
+
+	virtual ~Compositor();
+
+	/** Adds a layer on top, @return false if full **/
+	bool add(Layer *layer);
+
+	uint8_t layers() { return _count; }
+
+	/** Renders all layers bottom to top into @rgb (3 bytes per pixel), the bottom one ignores its mode **/
+	void compose(uint8_t *rgb, unsigned long now);
+
+	void compose(uint8_t *rgb) { compose(rgb, Functions::now()); }
+};
+
+#endif /* COMPOSITOR_H_ */
@@ -10,6 +10,64 @@ def can_be_digital(rgb):
     return is_digital
 
 
+# Must match name_hash() in color_names.cpp
+def name_hash(name, seed):
+    h = 2166136261 ^ seed
+    for c in name.encode():
+        h = ((h ^ c) * 16777619) & 0xFFFFFFFF
+    return h ^ (h >> 16)
+
+
+def perfect_hash(keys, slots, buckets):
+    """ Hash and displace: every bucket of keys (by seed 0 hash) gets the
+    first seed that sends all its keys to free slots. """
+    groups = [[] for _ in range(buckets)]
+    for i, k in enumerate(keys):
+        groups[name_hash(k, 0) & (buckets - 1)].append(i)
+
+    seeds = [0] * buckets
+    table = [0xFFFF] * slots
+    for b in sorted(range(buckets), key=lambda b: -len(groups[b])):
+        if not groups[b]:
+            continue
+        seed = 1
+        while True:
+            s = [name_hash(keys[i], seed) & (slots - 1) for i in groups[b]]
+            if len(set(s)) == len(s) and all(table[x] == 0xFFFF for x in s):
+                break
+            seed += 1
+        assert seed < 256, "no seed found, use more slots"
+        seeds[b] = seed
+        for i, x in zip(groups[b], s):
+            table[x] = i
+    return seeds, table
+
+
+# Must match color_distance() in color_names.cpp
+DISTANCE_WEIGHTS = (2, 4, 3)
+
+
+def kd_tree(ids, rgbs, tree, lo, hi):
+    """ Sorts ids[lo:hi] in place as an implicit k-d tree: the node of a range is
+    its middle item, split on the axis of largest spread, lower items before. """
+    if hi - lo <= 0:
+        return
+    spans = [max(rgbs[i][a] for i in ids[lo:hi]) - min(rgbs[i][a] for i in ids[lo:hi]) for a in range(3)]
+    axis = max(range(3), key=lambda a: spans[a] * DISTANCE_WEIGHTS[a])
+    ids[lo:hi] = sorted(ids[lo:hi], key=lambda i: (rgbs[i][axis], i))
+    mid = (lo + hi) // 2
+    tree[mid] = ids[mid] | (axis << 14)
+    kd_tree(ids, rgbs, tree, lo, mid)
+    kd_tree(ids, rgbs, tree, mid + 1, hi)
+
+
+def write_array(out, declaration, values, per_line=16):
+    out.write(declaration + " = {\n")
+    for n in range(0, len(values), per_line):
+        out.write("    " + ", ".join(str(v) for v in values[n:n + per_line]) + ",\n")
+    out.write("};\n\n")
+
+
 f = open("colors.json","r")
 out = open("colors_defines.h","w")
 p = yaml.safe_load(f.read())
@@ -34,6 +92,40 @@ out.write("\n#endif")
 f.close()
 out.close()
 
+# NAMED COLORS IDS AND LOOKUP TABLES
 
+keys = sorted(p.keys())
+slots = 1
+while slots < len(keys):
+    slots *= 2
+buckets = slots // 4
+seeds, table = perfect_hash(keys, slots, buckets)
 
+out = open("colors_ids.h", "w")
+out.write("#ifndef COLORS_IDS_H_\n#define COLORS_IDS_H_\n\n")
+out.write("// Generated by def_colors.py from colors.json\n\n")
+out.write("#define COLOR_NAMES_COUNT {}\n\n".format(len(keys)))
+out.write("typedef enum\n{\n")
+for k in keys:
+    out.write("    COLOR_ID_" + k.upper() + ",\n")
+out.write("} ColorId;\n\n#endif")
+out.close()
 
+out = open("colors_table.h", "w")
+out.write("#ifndef COLORS_TABLE_H_\n#define COLORS_TABLE_H_\n\n")
+out.write("// Generated by def_colors.py from colors.json, include only from color_names.cpp\n\n")
+out.write("#define COLOR_NAMES_SLOTS {}\n#define COLOR_NAMES_BUCKETS {}\n\n".format(slots, buckets))
+for n, k in enumerate(keys):
+    out.write("static const char COLOR_NAME_{}[] PROGMEM = \"{}\";\n".format(n, k))
+out.write("\n")
+write_array(out, "static const char *const COLOR_NAMES[] PROGMEM", ["COLOR_NAME_{}".format(n) for n in range(len(keys))], 8)
+write_array(out, "static const uint8_t COLOR_RGB[][3] PROGMEM", ["{" + "{},{},{}".format(*p[k]['rgb']) + "}" for k in keys], 8)
+write_array(out, "static const uint8_t COLOR_NAME_SEEDS[COLOR_NAMES_BUCKETS] PROGMEM", seeds)
+write_array(out, "static const uint16_t COLOR_NAME_SLOTS[COLOR_NAMES_SLOTS] PROGMEM", table)
+rgbs = [p[k]['rgb'] for k in keys]
+tree = [0] * len(keys)
+kd_tree(list(range(len(keys))), rgbs, tree, 0, len(keys))
+out.write("// Nearest color k-d tree, node of [lo,hi) is (lo+hi)/2: color id | split axis << 14\n")
+write_array(out, "static const uint16_t COLOR_KD_TREE[COLOR_NAMES_COUNT] PROGMEM", tree)
+out.write("#endif")
+out.close()
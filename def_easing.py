@@ -0,0 +1,56 @@
+import math
+
+# Easing curves sampled into 65 points, read with linear interpolation by easing.cpp
+
+
+def bounce_out(t):
+    n, d = 7.5625, 2.75
+    if t < 1 / d:
+        return n * t * t
+    if t < 2 / d:
+        t -= 1.5 / d
+        return n * t * t + 0.75
+    if t < 2.5 / d:
+        t -= 2.25 / d
+        return n * t * t + 0.9375
+    t -= 2.625 / d
+    return n * t * t + 0.984375
+
+
+def in_out(ease_in):
+    return lambda t: ease_in(2 * t) / 2 if t < 0.5 else 1 - ease_in(2 - 2 * t) / 2
+
+
+def out(ease_in):
+    return lambda t: 1 - ease_in(1 - t)
+
+
+quad = lambda t: t * t
+cubic = lambda t: t * t * t
+sine = lambda t: 1 - math.cos(t * math.pi / 2)
+expo = lambda t: 0 if t == 0 else 2 ** (10 * t - 10)
+bounce = lambda t: 1 - bounce_out(1 - t)
+
+# Order must match Easing enum in easing.h, EASE_LINEAR has no table
+curves = [
+    ("QUAD_IN", quad), ("QUAD_OUT", out(quad)), ("QUAD_IN_OUT", in_out(quad)),
+    ("CUBIC_IN", cubic), ("CUBIC_OUT", out(cubic)), ("CUBIC_IN_OUT", in_out(cubic)),
+    ("SINE_IN", sine), ("SINE_OUT", out(sine)), ("SINE_IN_OUT", in_out(sine)),
+    ("EXPO_IN", expo), ("EXPO_OUT", out(expo)), ("EXPO_IN_OUT", in_out(expo)),
+    ("BOUNCE_IN", bounce), ("BOUNCE_OUT", out(bounce)), ("BOUNCE_IN_OUT", in_out(bounce)),
+]
+
+POINTS = 65
+
+out_file = open("easing_tables.h", "w")
+out_file.write("#ifndef EASING_TABLES_H_\n#define EASING_TABLES_H_\n\n")
+out_file.write("// Generated by def_easing.py, include only from easing.cpp\n\n")
+out_file.write("#define EASING_TABLE_POINTS {}\n\n".format(POINTS))
+out_file.write("static const uint16_t EASING_TABLES[][EASING_TABLE_POINTS] PROGMEM = {\n")
+for name, f in curves:
+    values = [min(65535, max(0, int(round(f(n / (POINTS - 1)) * 65535)))) for n in range(POINTS)]
+    out_file.write("    // EASE_" + name + "\n    {")
+    out_file.write(", ".join(str(v) for v in values))
+    out_file.write("},\n")
+out_file.write("};\n\n#endif")
+out_file.close()
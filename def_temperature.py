@@ -0,0 +1,193 @@
+import math
+import struct
+from multiprocessing import Pool, cpu_count
+
+# Fits piecewise quadratics in fixed point to temperature_to_rgb over
+# KELVIN_MIN..KELVIN_MAX, checks every kelvin and writes temperature_table.h.
+# The segment evaluation must match temperature_segment() in rgb_utils.cpp.
+
+KELVIN_MIN = 1000
+KELVIN_MAX = 40000
+# Max error allowed against temperature_to_rgb, 8 bit levels
+TOLERANCE = 1
+CHANNELS = ("RED", "GREEN", "BLUE")
+
+
+def f32(x):
+    return struct.unpack("f", struct.pack("f", x))[0]
+
+
+def to_byte(v):
+    # (uint8_t)constrain(v, 0, 255) of a float
+    v = f32(v)
+    return int(min(255.0, max(0.0, v)))
+
+
+def reference(kelvin):
+    """ temperature_to_rgb at full brightness """
+    temp = f32(f32(min(65500.0, max(0.0, float(kelvin)))) / 100.0)
+    r = b = 255.0
+    if temp > 66.0:
+        r = 329.698727466 * math.pow(temp - 60.0, -0.1332047592)
+        g = 288.1221695283 * math.pow(temp - 60.0, -0.0755148492)
+    else:
+        g = 99.4708025861 * math.log(temp) - 161.1195681661
+        b = 0 if temp <= 19.0 else 138.5177312231 * math.log(temp - 10.0) - 305.0447927307
+    return to_byte(r), to_byte(g), to_byte(b)
+
+
+TARGETS = None
+
+
+def init_targets():
+    global TARGETS
+    TARGETS = [reference(k) for k in range(KELVIN_MIN, KELVIN_MAX + 1)]
+
+
+def target(channel, kelvin):
+    return TARGETS[kelvin - KELVIN_MIN][channel]
+
+
+def solve(m, v):
+    """ Gaussian elimination of a small system """
+    n = len(v)
+    for i in range(n):
+        p = max(range(i, n), key=lambda r: abs(m[r][i]))
+        m[i], m[p] = m[p], m[i]
+        v[i], v[p] = v[p], v[i]
+        if abs(m[i][i]) < 1e-12:
+            return [0.0] * n
+        for r in range(i + 1, n):
+            f = m[r][i] / m[i][i]
+            for c in range(i, n):
+                m[r][c] -= f * m[i][c]
+            v[r] -= f * v[i]
+    x = [0.0] * n
+    for i in reversed(range(n)):
+        x[i] = (v[i] - sum(m[i][c] * x[c] for c in range(i + 1, n))) / m[i][i]
+    return x
+
+
+def least_squares(channel, start, end, degree):
+    """ Coefficients of t = kelvin - start, values in 8.8 fixed point """
+    length = max(1, end - start)
+    n = degree + 1
+    m = [[0.0] * n for _ in range(n)]
+    v = [0.0] * n
+    for k in range(start, end + 1):
+        x = (k - start) / length
+        y = target(channel, k) * 256.0
+        p = [x ** i for i in range(n)]
+        for i in range(n):
+            v[i] += p[i] * y
+            for j in range(n):
+                m[i][j] += p[i] * p[j]
+    c = solve(m, v) + [0.0] * (3 - n)
+    return c[0], c[1] / length, c[2] / (length * length)
+
+
+def quantize(c, limit=32767):
+    """ Largest shift keeping round(c * 2^shift) in 16 bits """
+    if c == 0:
+        return 0, 0
+    shift = 0
+    while shift < 30 and abs(round(c * 2 ** (shift + 1))) <= limit:
+        shift += 1
+    return int(round(c * 2 ** shift)), shift
+
+
+def evaluate(segment, kelvin):
+    start, a0, a1, a2, s1, s2 = segment
+    t = kelvin - start
+    v = a0 + ((a1 * t) >> s1) + ((a2 * ((t * t) >> 16)) >> s2)
+    return min(255, max(0, (v + 128) >> 8))
+
+
+def make_segment(channel, start, end, degree):
+    c0, c1, c2 = least_squares(channel, start, end, degree)
+    a1, s1 = quantize(c1)
+    a2, s2 = quantize(c2 * 65536.0)
+    segment = [start, int(round(c0)), a1, a2, s1, s2]
+    # Centers the residuals of the quantized curve
+    errors = [target(channel, k) * 256 - (segment[1] + ((a1 * (k - start)) >> s1) + ((a2 * (((k - start) ** 2) >> 16)) >> s2))
+              for k in range(start, end + 1)]
+    segment[1] += (max(errors) + min(errors)) // 2
+    return tuple(segment)
+
+
+def max_error(channel, segment, start, end):
+    return max(abs(evaluate(segment, k) - target(channel, k)) for k in range(start, end + 1))
+
+
+def fit_channel(args):
+    """ Greedy segmentation, each segment as long as it stays within TOLERANCE """
+    channel, degree = args
+    segments = []
+    start = KELVIN_MIN
+    while start <= KELVIN_MAX:
+        # Doubling then bisection of the segment end
+        good = start
+        step = 64
+        end = min(KELVIN_MAX, start + step)
+        while True:
+            if max_error(channel, make_segment(channel, start, end, degree), start, end) <= TOLERANCE:
+                good = end
+                if end == KELVIN_MAX:
+                    break
+                step *= 2
+                end = min(KELVIN_MAX, start + step)
+            else:
+                break
+        low, high = good, end
+        while high - low > 1 and low != KELVIN_MAX:
+            mid = (low + high) // 2
+            if max_error(channel, make_segment(channel, start, mid, degree), start, mid) <= TOLERANCE:
+                low = mid
+            else:
+                high = mid
+        segments.append(make_segment(channel, start, low, degree))
+        start = low + 1
+    return channel, degree, segments
+
+
+def check_range(args):
+    """ Max error of the tables against temperature_to_rgb over [first,last] """
+    tables, first, last = args
+    worst = [0, 0, 0]
+    for k in range(first, last + 1):
+        for c in range(3):
+            segment = [s for s in tables[c] if s[0] <= k][-1]
+            worst[c] = max(worst[c], abs(evaluate(segment, k) - target(c, k)))
+    return worst
+
+
+if __name__ == "__main__":
+    with Pool(cpu_count(), initializer=init_targets) as pool:
+        init_targets()
+        # Every channel with linear and quadratic segments, smallest table wins
+        results = pool.map(fit_channel, [(c, d) for c in range(3) for d in (1, 2)])
+        tables = []
+        for c in range(3):
+            options = [r for r in results if r[0] == c]
+            best = min(options, key=lambda r: (len(r[2]), r[1]))
+            tables.append(best[2])
+            print("{}: {} segments, degree {}".format(CHANNELS[c], len(best[2]), best[1]))
+
+        chunk = (KELVIN_MAX - KELVIN_MIN + 1) // cpu_count() + 1
+        ranges = [(tables, k, min(KELVIN_MAX, k + chunk - 1)) for k in range(KELVIN_MIN, KELVIN_MAX + 1, chunk)]
+        worst = [max(w[c] for w in pool.map(check_range, ranges)) for c in range(3)]
+        print("max error r,g,b: {}".format(worst))
+
+    out_file = open("temperature_table.h", "w")
+    out_file.write("#ifndef TEMPERATURE_TABLE_H_\n#define TEMPERATURE_TABLE_H_\n\n")
+    out_file.write("// Generated by def_temperature.py, include only from rgb_utils.cpp\n")
+    out_file.write("// Max error against temperature_to_rgb r,g,b: {}\n\n".format(", ".join(str(w) for w in worst)))
+    out_file.write("#define TEMPERATURE_TABLE_MIN {}\n#define TEMPERATURE_TABLE_MAX {}\n\n".format(KELVIN_MIN, KELVIN_MAX))
+    for c in range(3):
+        out_file.write("#define TEMPERATURE_{}_SEGMENTS {}\n".format(CHANNELS[c], len(tables[c])))
+        out_file.write("static const TemperatureSegment TEMPERATURE_{}[] PROGMEM = {{\n".format(CHANNELS[c]))
+        for s in tables[c]:
+            out_file.write("    {{{}, {}, {}, {}, {}, {}}},\n".format(*s))
+        out_file.write("};\n\n")
+    out_file.write("#endif")
+    out_file.close()
@@ -0,0 +1,42 @@
+#include "easing.h"
+#include "easing_tables.h"
+
+uint16_t ease16(uint8_t curve, uint16_t t)
+{
+    if (curve == EASE_LINEAR || curve >= EASING_COUNT)
+        return t;
+
+    const uint16_t *table = EASING_TABLES[curve - 1];
+    if (t == 0xFFFF)
+        return pgm_read_word(&table[EASING_TABLE_POINTS - 1]);
+    // 64 segments of 1024 steps
+    uint8_t index = t >> 10;
+    int32_t a = pgm_read_word(&table[index]);
+    int32_t b = pgm_read_word(&table[index + 1]);
+    return a + (((b - a) * (int32_t)(t & 0x3FF)) >> 10);
+}
+
+uint8_t ease8(uint8_t curve, uint8_t t)
+{
+    return ease16(curve, (uint16_t)t * 257) >> 8;
+}
+
+float ease(uint8_t curve, float t)
+{
+    if (t <= 0.0f)
+        return 0.0f;
+    if (t >= 1.0f)
+        return 1.0f;
+    return ease16(curve, (uint16_t)(t * 65535.0f)) / 65535.0f;
+}
+
+RGBOutput eased_progression(uint8_t curve, unsigned long progress, unsigned long progressStart, unsigned long progressEnd, RGBOutput startV, RGBOutput endV)
+{
+    if (progress <= progressStart)
+        return startV;
+    if (progress >= progressEnd)
+        return endV;
+
+    uint8_t p = ease8(curve, ((progress - progressStart) << 8) / (progressEnd - progressStart));
+    return RGBOutput(blend8(startV.red, endV.red, p), blend8(startV.green, endV.green, p), blend8(startV.blue, endV.blue, p));
+}
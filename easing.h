@@ -0,0 +1,47 @@
+/*
+ * easing.h
+ *
+ * Easing curves for transitions, evaluated from tables generated by
+ * def_easing.py: a lookup and a linear interpolation instead of pow/sin.
+ */
+
+#ifndef EASING_H_
+#define EASING_H_
+
+#include <Arduino.h>
+#include "rgb_utils.h"
+
+typedef enum
+{
+	EASE_LINEAR,
+	EASE_QUAD_IN,
+	EASE_QUAD_OUT,
+	EASE_QUAD_IN_OUT,
+	EASE_CUBIC_IN,
+	EASE_CUBIC_OUT,
+	EASE_CUBIC_IN_OUT,
+	EASE_SINE_IN,
+	EASE_SINE_OUT,
+	EASE_SINE_IN_OUT,
+	EASE_EXPO_IN,
+	EASE_EXPO_OUT,
+	EASE_EXPO_IN_OUT,
+	EASE_BOUNCE_IN,
+	EASE_BOUNCE_OUT,
+	EASE_BOUNCE_IN_OUT,
+	EASING_COUNT
+} Easing;
+
+/** Eases @t [0,65535] with @curve, returns [0,65535] **/
+uint16_t ease16(uint8_t curve, uint16_t t);
+
+/** Eases @t [0,255] with @curve, returns [0,255] **/
+uint8_t ease8(uint8_t curve, uint8_t t);
+
+/** Eases @t [0,1] with @curve, values out of range are clamped **/
+float ease(uint8_t curve, float t);
+
+/** RGBOutput::PROGRESSION with an easing curve **/
+RGBOutput eased_progression(uint8_t curve, unsigned long progress, unsigned long progressStart, unsigned long progressEnd, RGBOutput startV, RGBOutput endV);
+
+#endif /* EASING_H_ */
@@ -0,0 +1,41 @@
+#ifndef EASING_TABLES_H_
+#define EASING_TABLES_H_
+
+// Generated by def_easing.py, include only from easing.cpp
+
+#define EASING_TABLE_POINTS 65
+
+static const uint16_t EASING_TABLES[][EASING_TABLE_POINTS] PROGMEM = {
+    // EASE_QUAD_IN
+    {0, 16, 64, 144, 256, 400, 576, 784, 1024, 1296, 1600, 1936, 2304, 2704, 3136, 3600, 4096, 4624, 5184, 5776, 6400, 7056, 7744, 8464, 9216, 10000, 10816, 11664, 12544, 13456, 14400, 15376, 16384, 17424, 18496, 19600, 20736, 21904, 23104, 24336, 25600, 26896, 28224, 29584, 30976, 32400, 33855, 35343, 36863, 38415, 39999, 41615, 43263, 44943, 46655, 48399, 50175, 51983, 53823, 55695, 57599, 59535, 61503, 63503, 65535},
+    // EASE_QUAD_OUT
+    {0, 2032, 4032, 6000, 7936, 9840, 11712, 13552, 15360, 17136, 18880, 20592, 22272, 23920, 25536, 27120, 28672, 30192, 31680, 33135, 34559, 35951, 37311, 38639, 39935, 41199, 42431, 43631, 44799, 45935, 47039, 48111, 49151, 50159, 51135, 52079, 52991, 53871, 54719, 55535, 56319, 57071, 57791, 58479, 59135, 59759, 60351, 60911, 61439, 61935, 62399, 62831, 63231, 63599, 63935, 64239, 64511, 64751, 64959, 65135, 65279, 65391, 65471, 65519, 65535},
+    // EASE_QUAD_IN_OUT
+    {0, 32, 128, 288, 512, 800, 1152, 1568, 2048, 2592, 3200, 3872, 4608, 5408, 6272, 7200, 8192, 9248, 10368, 11552, 12800, 14112, 15488, 16928, 18432, 20000, 21632, 23328, 25088, 26912, 28800, 30752, 32768, 34783, 36735, 38623, 40447, 42207, 43903, 45535, 47103, 48607, 50047, 51423, 52735, 53983, 55167, 56287, 57343, 58335, 59263, 60127, 60927, 61663, 62335, 62943, 63487, 63967, 64383, 64735, 65023, 65247, 65407, 65503, 65535},
+    // EASE_CUBIC_IN
+    {0, 0, 2, 7, 16, 31, 54, 86, 128, 182, 250, 333, 432, 549, 686, 844, 1024, 1228, 1458, 1715, 2000, 2315, 2662, 3042, 3456, 3906, 4394, 4921, 5488, 6097, 6750, 7448, 8192, 8984, 9826, 10719, 11664, 12663, 13718, 14830, 16000, 17230, 18522, 19876, 21296, 22781, 24334, 25955, 27648, 29412, 31250, 33162, 35151, 37219, 39365, 41593, 43903, 46298, 48777, 51344, 53999, 56744, 59581, 62511, 65535},
+    // EASE_CUBIC_OUT
+    {0, 3024, 5954, 8791, 11536, 14191, 16758, 19237, 21632, 23942, 26170, 28316, 30384, 32373, 34285, 36123, 37887, 39580, 41201, 42754, 44239, 45659, 47013, 48305, 49535, 50705, 51817, 52872, 53871, 54816, 55709, 56551, 57343, 58087, 58785, 59438, 60047, 60614, 61141, 61629, 62079, 62493, 62873, 63220, 63535, 63820, 64077, 64307, 64511, 64691, 64849, 64986, 65103, 65202, 65285, 65353, 65407, 65449, 65481, 65504, 65519, 65528, 65533, 65535, 65535},
+    // EASE_CUBIC_IN_OUT
+    {0, 1, 8, 27, 64, 125, 216, 343, 512, 729, 1000, 1331, 1728, 2197, 2744, 3375, 4096, 4913, 5832, 6859, 8000, 9261, 10648, 12167, 13824, 15625, 17576, 19683, 21952, 24389, 27000, 29791, 32768, 35744, 38535, 41146, 43583, 45852, 47959, 49910, 51711, 53368, 54887, 56274, 57535, 58676, 59703, 60622, 61439, 62160, 62791, 63338, 63807, 64204, 64535, 64806, 65023, 65192, 65319, 65410, 65471, 65508, 65527, 65534, 65535},
+    // EASE_SINE_IN
+    {0, 20, 79, 178, 316, 493, 709, 965, 1259, 1592, 1964, 2374, 2822, 3308, 3831, 4391, 4989, 5622, 6292, 6998, 7738, 8514, 9324, 10168, 11045, 11955, 12897, 13871, 14876, 15911, 16977, 18071, 19195, 20346, 21524, 22729, 23960, 25216, 26496, 27799, 29126, 30474, 31843, 33233, 34642, 36070, 37515, 38978, 40456, 41949, 43457, 44978, 46511, 48056, 49611, 51176, 52750, 54331, 55919, 57513, 59111, 60714, 62319, 63927, 65535},
+    // EASE_SINE_OUT
+    {0, 1608, 3216, 4821, 6424, 8022, 9616, 11204, 12785, 14359, 15924, 17479, 19024, 20557, 22078, 23586, 25079, 26557, 28020, 29465, 30893, 32302, 33692, 35061, 36409, 37736, 39039, 40319, 41575, 42806, 44011, 45189, 46340, 47464, 48558, 49624, 50659, 51664, 52638, 53580, 54490, 55367, 56211, 57021, 57797, 58537, 59243, 59913, 60546, 61144, 61704, 62227, 62713, 63161, 63571, 63943, 64276, 64570, 64826, 65042, 65219, 65357, 65456, 65515, 65535},
+    // EASE_SINE_IN_OUT
+    {0, 39, 158, 355, 630, 982, 1411, 1915, 2494, 3146, 3869, 4662, 5522, 6448, 7438, 8488, 9597, 10762, 11980, 13248, 14563, 15922, 17321, 18758, 20228, 21728, 23256, 24806, 26375, 27960, 29556, 31160, 32768, 34375, 35979, 37575, 39160, 40729, 42279, 43807, 45307, 46777, 48214, 49613, 50972, 52287, 53555, 54773, 55938, 57047, 58097, 59087, 60013, 60873, 61666, 62389, 63041, 63620, 64124, 64553, 64905, 65180, 65377, 65496, 65535},
+    // EASE_EXPO_IN
+    {0, 71, 79, 89, 99, 110, 123, 137, 152, 170, 189, 211, 235, 262, 292, 325, 362, 403, 450, 501, 558, 622, 693, 773, 861, 960, 1069, 1192, 1328, 1480, 1649, 1838, 2048, 2282, 2543, 2834, 3158, 3520, 3922, 4371, 4871, 5428, 6049, 6741, 7512, 8371, 9329, 10396, 11585, 12910, 14387, 16033, 17867, 19910, 22188, 24726, 27554, 30706, 34218, 38132, 42494, 47355, 52772, 58808, 65535},
+    // EASE_EXPO_OUT
+    {0, 6727, 12763, 18180, 23041, 27403, 31317, 34829, 37981, 40809, 43347, 45625, 47668, 49502, 51148, 52625, 53950, 55139, 56206, 57164, 58023, 58794, 59486, 60107, 60664, 61164, 61613, 62015, 62377, 62701, 62992, 63253, 63487, 63697, 63886, 64055, 64207, 64343, 64466, 64575, 64674, 64762, 64842, 64913, 64977, 65034, 65085, 65132, 65173, 65210, 65243, 65273, 65300, 65324, 65346, 65365, 65383, 65398, 65412, 65425, 65436, 65446, 65456, 65464, 65535},
+    // EASE_EXPO_IN_OUT
+    {0, 40, 49, 61, 76, 95, 117, 146, 181, 225, 279, 347, 431, 535, 664, 825, 1024, 1272, 1579, 1961, 2435, 3024, 3756, 4664, 5793, 7193, 8933, 11094, 13777, 17109, 21247, 26386, 32768, 39149, 44288, 48426, 51758, 54441, 56602, 58342, 59742, 60871, 61779, 62511, 63100, 63574, 63956, 64263, 64511, 64710, 64871, 65000, 65104, 65188, 65256, 65310, 65354, 65389, 65418, 65440, 65459, 65474, 65486, 65495, 65535},
+    // EASE_BOUNCE_IN
+    {0, 583, 924, 1023, 880, 495, 252, 1495, 2496, 3255, 3772, 4047, 4080, 3871, 3420, 2727, 1792, 615, 1500, 4063, 6384, 8463, 10300, 11895, 13248, 14359, 15228, 15855, 16240, 16383, 16284, 15943, 15360, 14535, 13468, 12159, 10608, 8815, 6780, 4503, 1984, 1527, 6972, 12175, 17136, 21855, 26332, 30567, 34559, 38310, 41819, 45086, 48111, 50894, 53435, 55734, 57791, 59606, 61179, 62510, 63599, 64446, 65051, 65414, 65535},
+    // EASE_BOUNCE_OUT
+    {0, 121, 484, 1089, 1936, 3025, 4356, 5929, 7744, 9801, 12100, 14641, 17424, 20449, 23716, 27225, 30976, 34968, 39203, 43680, 48399, 53360, 58563, 64008, 63551, 61032, 58755, 56720, 54927, 53376, 52067, 51000, 50175, 49592, 49251, 49152, 49295, 49680, 50307, 51176, 52287, 53640, 55235, 57072, 59151, 61472, 64035, 64920, 63743, 62808, 62115, 61664, 61455, 61488, 61763, 62280, 63039, 64040, 65283, 65040, 64655, 64512, 64611, 64952, 65535},
+    // EASE_BOUNCE_IN_OUT
+    {0, 462, 440, 126, 1248, 1886, 2040, 1710, 896, 750, 3192, 5150, 6624, 7614, 8120, 8142, 7680, 6734, 5304, 3390, 992, 3486, 8568, 13166, 17280, 20910, 24056, 26718, 28896, 30590, 31800, 32526, 32768, 33009, 33735, 34945, 36639, 38817, 41479, 44625, 48255, 52369, 56967, 62049, 64543, 62145, 60231, 58801, 57855, 57393, 57415, 57921, 58911, 60385, 62343, 64785, 64639, 63825, 63495, 63649, 64287, 65409, 65095, 65073, 65535},
+};
+
+#endif
\ No newline at end of file
@@ -0,0 +1,99 @@
+/*
+ * Accuracy of the audio analysis stage against float references.
+ * The Hann window and the Q15 FFT are checked with quiet and full scale
+ * input, where a wrapping sample shows up as a large error.
+ */
+#include <audio_analysis.h>
+
+const unsigned long baudRate = 115200;
+
+const uint8_t LOG2N = 7;
+const uint16_t N = 1 << LOG2N;
+// Max error allowed in LSB, window and FFT
+const float WINDOW_TOLERANCE = 2;
+const float FFT_TOLERANCE = 8;
+
+int16_t re[N], im[N];
+
+float windowError(int16_t level)
+{
+    float error = 0;
+    for (uint16_t n = 0; n < N; n++)
+        re[n] = level;
+    hann_q15(re, N);
+    for (uint16_t n = 0; n < N; n++)
+    {
+        float expected = level * (0.5f - 0.5f * cos(TWO_PI * n / N));
+        error = max(error, fabs(re[n] - expected));
+    }
+    return error;
+}
+
+/** Sine at bin 5 plus a cosine at bin 20, peak @amplitude **/
+float sample(uint16_t n, float amplitude)
+{
+    return amplitude * (0.6f * sin(TWO_PI * 5 * n / N) + 0.4f * cos(TWO_PI * 20 * n / N));
+}
+
+/** Against a float DFT scaled by 1/N as fft_q15 scales **/
+float fftError(float amplitude)
+{
+    for (uint16_t n = 0; n < N; n++)
+    {
+        re[n] = sample(n, amplitude);
+        im[n] = 0;
+    }
+    fft_q15(re, im, LOG2N);
+
+    float error = 0;
+    for (uint16_t k = 0; k < N; k++)
+    {
+        float sr = 0, si = 0;
+        for (uint16_t n = 0; n < N; n++)
+        {
+            float w = TWO_PI * (uint32_t)((k * n) % N) / N;
+            float x = (int16_t)sample(n, amplitude);
+            sr += x * cos(w);
+            si -= x * sin(w);
+        }
+        error = max(error, max(fabs(sr / N - re[k]), fabs(si / N - im[k])));
+    }
+    return error;
+}
+
+void printResult(bool pass)
+{
+    Serial.println(pass ? " PASS" : " FAIL");
+}
+
+void setup()
+{
+    Serial.begin(baudRate);
+    Serial.println("AUDIO ANALYSIS (max error in LSB)");
+
+    const int16_t levels[] = {2000, 20000, 32767, -32768};
+    for (uint8_t n = 0; n < 4; n++)
+    {
+        float error = windowError(levels[n]);
+        Serial.print("hann_q15 constant ");
+        Serial.print(levels[n]);
+        Serial.print(": ");
+        Serial.print(error);
+        printResult(error <= WINDOW_TOLERANCE);
+    }
+
+    const float amplitudes[] = {8000, 32767};
+    for (uint8_t n = 0; n < 2; n++)
+    {
+        float error = fftError(amplitudes[n]);
+        Serial.print("fft_q15 amplitude ");
+        Serial.print(amplitudes[n]);
+        Serial.print(": ");
+        Serial.print(error);
+        printResult(error <= FFT_TOLERANCE);
+    }
+}
+
+void loop()
+{
+}
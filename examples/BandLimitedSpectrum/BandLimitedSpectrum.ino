@@ -0,0 +1,95 @@
+#include <polyblep.h>
+
+const unsigned long baudRate = 115200;
+
+// Bins of the analysis, the fundamental lands exactly on bin FUNDAMENTAL_BIN
+const uint16_t SAMPLES = 256;
+const uint16_t FUNDAMENTAL_BIN = 7;
+
+float samples[SAMPLES];
+
+typedef enum
+{
+    WAVE_SAWTOOTH,
+    WAVE_SQUARE,
+    WAVE_PULSE
+} Wave;
+
+// Minimum alias reduction per wave in dB, PolyBLEP gives about 16 on each
+const float MIN_REDUCTION[] = {13.0f, 13.0f, 13.0f};
+
+/** One period of @wave for phase @p, naive or band limited **/
+float waveSample(uint8_t wave, float p, float dt, bool bandLimited)
+{
+    switch (wave)
+    {
+    case WAVE_SAWTOOTH:
+        return bandLimited ? blep_sawtooth(p, dt) : 2.0f * p - 1.0f;
+    case WAVE_SQUARE:
+        return bandLimited ? blep_square(p, dt) : (p < 0.5f ? 1.0f : -1.0f);
+    default:
+        return bandLimited ? blep_pulse(p, dt, 0.3f) : (p < 0.3f ? 1.0f : 0.0f);
+    }
+}
+
+/** Power of bin @k, Goertzel recurrence **/
+float binPower(uint16_t k)
+{
+    float c = 2.0f * cos(TWO_PI * k / SAMPLES);
+    float s1 = 0, s2 = 0;
+    for (uint16_t n = 0; n < SAMPLES; n++)
+    {
+        float s0 = samples[n] + c * s1 - s2;
+        s2 = s1;
+        s1 = s0;
+    }
+    return s1 * s1 + s2 * s2 - c * s1 * s2;
+}
+
+/** Energy out of the harmonic bins relative to the harmonics, dB **/
+float aliasLevel(uint8_t wave, bool bandLimited)
+{
+    BlepOscillator osc;
+    osc.setFrequency(FUNDAMENTAL_BIN, SAMPLES);
+    for (uint16_t n = 0; n < SAMPLES; n++)
+        samples[n] = waveSample(wave, osc.step(), osc.dt, bandLimited);
+
+    float harmonics = 0, aliases = 0;
+    // Bin 0 is the offset
+    for (uint16_t k = 1; k < SAMPLES / 2; k++)
+    {
+        if (k % FUNDAMENTAL_BIN == 0)
+            harmonics += binPower(k);
+        else
+            aliases += binPower(k);
+    }
+    return 10.0f * log10(aliases / harmonics);
+}
+
+void printWave(const char *name, uint8_t wave)
+{
+    float naive = aliasLevel(wave, false);
+    float limited = aliasLevel(wave, true);
+    Serial.print(name);
+    Serial.print(" naive: ");
+    Serial.print(naive);
+    Serial.print(" dB, band limited: ");
+    Serial.print(limited);
+    Serial.print(" dB, reduction: ");
+    Serial.print(naive - limited);
+    Serial.println(naive - limited >= MIN_REDUCTION[wave] ? " PASS" : " FAIL");
+}
+
+void setup()
+{
+    Serial.begin(baudRate);
+
+    Serial.println("ALIASED ENERGY (fundamental at fs * 7 / 256)");
+    printWave("sawtooth", WAVE_SAWTOOTH);
+    printWave("square", WAVE_SQUARE);
+    printWave("pulse 30%", WAVE_PULSE);
+}
+
+void loop()
+{
+}
@@ -0,0 +1,187 @@
+#include <color_names.h>
+#include <functions.h>
+#include <color_animation.h>
+
+const unsigned long baudRate = 115200;
+const uint16_t QUERIES = 200;
+
+// Fixed seed, same queries on every run
+uint32_t querySeed = 1;
+
+// Constant initialized, their constructors add nothing to the boot time
+const uint8_t BOOT_ANIMATIONS = 16;
+ColorAnimation bootAnimations[BOOT_ANIMATIONS];
+Functions bootFunctions;
+// micros() on entering setup(), boot time including global constructors
+unsigned long setupMicros;
+
+uint32_t nextQuery()
+{
+    querySeed = querySeed * 1664525UL + 1013904223UL;
+    return querySeed >> 8;
+}
+
+void benchmarkNearestColor()
+{
+    unsigned long t;
+    uint16_t mismatches = 0;
+    volatile uint16_t id;
+
+    querySeed = 1;
+    t = micros();
+    for (uint16_t n = 0; n < QUERIES; n++)
+    {
+        uint32_t c = nextQuery();
+        id = color_nearest(c >> 16, c >> 8, c);
+    }
+    float kd = (float)(micros() - t) / QUERIES;
+
+    querySeed = 1;
+    t = micros();
+    for (uint16_t n = 0; n < QUERIES; n++)
+    {
+        uint32_t c = nextQuery();
+        id = color_nearest_linear(c >> 16, c >> 8, c);
+    }
+    float linear = (float)(micros() - t) / QUERIES;
+
+    querySeed = 1;
+    for (uint16_t n = 0; n < QUERIES; n++)
+    {
+        uint32_t c = nextQuery();
+        if (color_nearest(c >> 16, c >> 8, c) != color_nearest_linear(c >> 16, c >> 8, c))
+            mismatches++;
+    }
+
+    Serial.println("NEAREST COLOR (us/query)");
+    Serial.print("k-d tree: ");
+    Serial.println(kd);
+    Serial.print("linear: ");
+    Serial.println(linear);
+    Serial.print("mismatches: ");
+    Serial.println(mismatches);
+    (void)id;
+}
+
+/** Average time of @f value() for @type over QUERIES samples **/
+float functionMicros(Functions &f, uint8_t type)
+{
+    volatile float v;
+    f.setFunctionType(type);
+    unsigned long t = micros();
+    for (uint16_t n = 0; n < QUERIES; n++)
+        v = f.value();
+    (void)v;
+    return (float)(micros() - t) / QUERIES;
+}
+
+void benchmarkNoise()
+{
+    Functions f;
+    f.setPeriodicData(1.0, 0.5, 0.0);
+
+    Serial.println("FUNCTIONS (us/sample, one harmonic or octave)");
+    Serial.print("cosines: ");
+    Serial.println(functionMicros(f, Functions::COSINES));
+    Serial.print("value noise: ");
+    Serial.println(functionMicros(f, Functions::VALUE_NOISE));
+    Serial.print("simplex noise: ");
+    Serial.println(functionMicros(f, Functions::SIMPLEX_NOISE));
+
+    volatile int16_t v;
+    unsigned long t = micros();
+    for (uint16_t n = 0; n < QUERIES; n++)
+        v = simplex_noise((uint32_t)n << 12, 5UL << 16);
+    Serial.print("simplex_noise 2D: ");
+    Serial.println((float)(micros() - t) / QUERIES);
+    t = micros();
+    for (uint16_t n = 0; n < QUERIES; n++)
+        v = simplex_noise((uint32_t)n << 12, 5UL << 16, 7UL << 16);
+    Serial.print("simplex_noise 3D: ");
+    Serial.println((float)(micros() - t) / QUERIES);
+    (void)v;
+}
+
+void benchmarkHsv()
+{
+    unsigned long t;
+    uint16_t errors8 = 0, errors16 = 0;
+    uint8_t r, g, b;
+
+    querySeed = 1;
+    t = micros();
+    for (uint16_t n = 0; n < QUERIES; n++)
+    {
+        uint32_t c = nextQuery();
+        uint16_t h;
+        uint8_t s, v;
+        rgb_to_hsv(c >> 16, c >> 8, c, h, s, v);
+        hsv_to_rgb(h, s, v, r, g, b);
+        errors8 += r != (uint8_t)(c >> 16) || g != (uint8_t)(c >> 8) || b != (uint8_t)c;
+    }
+    float float8 = (float)(micros() - t) / QUERIES;
+
+    querySeed = 1;
+    t = micros();
+    for (uint16_t n = 0; n < QUERIES; n++)
+    {
+        uint32_t c = nextQuery();
+        uint16_t h, s, v;
+        rgb_to_hsv16(c >> 16, c >> 8, c, h, s, v);
+        hsv16_to_rgb(h, s, v, r, g, b);
+        errors16 += r != (uint8_t)(c >> 16) || g != (uint8_t)(c >> 8) || b != (uint8_t)c;
+    }
+    float integer16 = (float)(micros() - t) / QUERIES;
+
+    Serial.println("HSV ROUND TRIP (us/color, inexact colors)");
+    Serial.print("8 bit float: ");
+    Serial.print(float8);
+    Serial.print(" ");
+    Serial.println(errors8);
+    Serial.print("16 bit integer: ");
+    Serial.print(integer16);
+    Serial.print(" ");
+    Serial.println(errors16);
+}
+
+void benchmarkBoot()
+{
+    volatile uint16_t sink = 0;
+    unsigned long t = micros();
+    for (uint16_t n = 0; n < QUERIES; n++)
+    {
+        ColorAnimation animation;
+        sink += animation.hue16();
+    }
+    float construct = (float)(micros() - t) / QUERIES;
+
+    t = micros();
+    for (uint8_t n = 0; n < BOOT_ANIMATIONS; n++)
+        bootAnimations[n].begin();
+    bootFunctions.begin();
+    float begin = (float)(micros() - t) / (BOOT_ANIMATIONS + 1);
+
+    Serial.println("BOOT (us)");
+    Serial.print("setup() entered at: ");
+    Serial.println(setupMicros);
+    Serial.print("ColorAnimation construction: ");
+    Serial.println(construct);
+    Serial.print("begin(): ");
+    Serial.println(begin);
+}
+
+void setup()
+{
+    setupMicros = micros();
+    Serial.begin(baudRate);
+
+    benchmarkBoot();
+
+    benchmarkNearestColor();
+    benchmarkNoise();
+    benchmarkHsv();
+}
+
+void loop()
+{
+}
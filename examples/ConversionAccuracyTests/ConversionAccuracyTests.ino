@@ -0,0 +1,250 @@
+/*
+ * Round trip accuracy of the color conversions against golden baselines.
+ * Every RGB value goes through the HSV and Oklab round trips and every kelvin
+ * through temperature_to_rgb, an optimized path must keep the reported errors.
+ *
+ * Full enumeration is meant for Linux builds of the library, where the RGB
+ * space is split over threads. AVR boards check one value out of RGB_STEP.
+ */
+#include <rgb_utils.h>
+
+#if defined(__linux__)
+#include <thread>
+#include <vector>
+const uint32_t RGB_STEP = 1;
+#else
+const uint32_t RGB_STEP = 4099;
+#endif
+
+const unsigned long baudRate = 115200;
+
+/** Per channel absolute error of a round trip **/
+struct ErrorStats
+{
+    uint8_t max;
+    uint32_t sum;
+    uint32_t count;
+
+    void reset() { max = sum = count = 0; }
+
+    void add(uint8_t a, uint8_t b)
+    {
+        uint8_t e = a > b ? a - b : b - a;
+        if (e > max)
+            max = e;
+        sum += e;
+        count++;
+    }
+
+    void merge(const ErrorStats &other)
+    {
+        if (other.max > max)
+            max = other.max;
+        sum += other.sum;
+        count += other.count;
+    }
+
+    float mean() { return count ? (float)sum / count : 0; }
+};
+
+typedef enum
+{
+    TRIP_HSV,
+    TRIP_HSV16,
+    TRIP_OKLAB,
+    TRIPS_COUNT
+} RoundTrip;
+
+const char *const TRIP_NAMES[TRIPS_COUNT] = {"rgb_to_hsv -> hsv_to_rgb", "rgb_to_hsv16 -> hsv16_to_rgb", "rgb_to_oklab -> oklab_to_rgb"};
+
+// Golden baselines, recorded from a full enumeration on a Linux host
+const uint8_t GOLDEN_MAX[TRIPS_COUNT] = {5, 0, 0};
+const float GOLDEN_MEAN[TRIPS_COUNT] = {0.3574f, 0.0f, 0.0f};
+const float MEAN_TOLERANCE = 0.01f;
+// Sum and FNV-1a hash of all temperature_to_rgb outputs, 0 to 65500 K at full brightness.
+// Checked on Linux only, AVR float pow/log may round some components differently.
+const uint32_t GOLDEN_TEMPERATURE_SUM = 39250342UL;
+const uint32_t GOLDEN_TEMPERATURE_HASH = 117117913UL;
+// temperature_to_rgb_fast against temperature_to_rgb over its table range
+const uint8_t GOLDEN_FAST_TEMPERATURE_MAX = 1;
+
+// Built by the compiler, HSV included, and kept in flash
+const Color CONSTEXPR_COLORS[] PROGMEM = {
+    Color(COLOR_AMBER), Color(COLOR_ALICE_BLUE), Color(COLOR_AMETHYST), Color(COLOR_ANDROID_GREEN),
+    0xFF0000_rgb, 0x00FF00_rgb, 0x0000FF_rgb, 0x808080_rgb, "#ffbf00"_rgb, "#FE0102"_rgb, "0a141e"_rgb};
+const uint8_t CONSTEXPR_COLORS_COUNT = sizeof(CONSTEXPR_COLORS) / sizeof(Color);
+
+void roundTrip(uint8_t trip, uint32_t c, uint8_t &r, uint8_t &g, uint8_t &b)
+{
+    uint8_t red = c >> 16, green = c >> 8, blue = c;
+    switch (trip)
+    {
+    case TRIP_HSV:
+    {
+        uint16_t h;
+        uint8_t s, v;
+        rgb_to_hsv(red, green, blue, h, s, v);
+        hsv_to_rgb(h, s, v, r, g, b);
+        break;
+    }
+    case TRIP_HSV16:
+    {
+        uint16_t h, s, v;
+        rgb_to_hsv16(red, green, blue, h, s, v);
+        hsv16_to_rgb(h, s, v, r, g, b);
+        break;
+    }
+    default:
+    {
+        float L, A, B;
+        rgb_to_oklab(red, green, blue, L, A, B);
+        oklab_to_rgb(L, A, B, r, g, b);
+        break;
+    }
+    }
+}
+
+/** Colors [first,last) by RGB_STEP **/
+void checkRange(uint8_t trip, uint32_t first, uint32_t last, ErrorStats *stats)
+{
+    stats->reset();
+    for (uint32_t c = first; c < last; c += RGB_STEP)
+    {
+        uint8_t r, g, b;
+        roundTrip(trip, c, r, g, b);
+        stats->add(c >> 16, r);
+        stats->add(c >> 8, g);
+        stats->add(c, b);
+    }
+}
+
+ErrorStats checkAll(uint8_t trip)
+{
+    const uint32_t colors = 1UL << 24;
+    ErrorStats total;
+#if defined(__linux__)
+    unsigned threads = std::thread::hardware_concurrency();
+    threads = threads ? threads : 1;
+    std::vector<ErrorStats> stats(threads);
+    std::vector<std::thread> workers;
+    uint32_t chunk = colors / threads;
+    for (unsigned n = 0; n < threads; n++)
+        workers.push_back(std::thread(checkRange, trip, n * chunk, n + 1 == threads ? colors : (n + 1) * chunk, &stats[n]));
+    total.reset();
+    for (unsigned n = 0; n < threads; n++)
+    {
+        workers[n].join();
+        total.merge(stats[n]);
+    }
+#else
+    checkRange(trip, 0, colors, &total);
+#endif
+    return total;
+}
+
+bool checkHue()
+{
+    for (long h = -32768; h <= 32767; h++)
+        if (hue_in_range(h) != ((h % 360) + 360) % 360)
+            return false;
+    for (uint16_t d = 0; d < 360; d++)
+        if (hue16_to_hue(hue_to_hue16(d)) != d)
+            return false;
+    return true;
+}
+
+void checkTemperature(uint32_t &sum, uint32_t &hash)
+{
+    sum = 0;
+    hash = 2166136261UL;
+    for (uint32_t k = 0; k <= 65500; k++)
+    {
+        uint8_t rgb[3];
+        temperature_to_rgb(k, 255, rgb[0], rgb[1], rgb[2]);
+        for (uint8_t n = 0; n < 3; n++)
+        {
+            sum += rgb[n];
+            hash = (hash ^ rgb[n]) * 16777619UL;
+        }
+    }
+}
+
+ErrorStats checkFastTemperature()
+{
+    ErrorStats stats;
+    stats.reset();
+    for (uint16_t k = 1000; k <= 40000; k++)
+    {
+        uint8_t exact[3], fast[3];
+        temperature_to_rgb(k, 255, exact[0], exact[1], exact[2]);
+        temperature_to_rgb_fast(k, 255, fast[0], fast[1], fast[2]);
+        for (uint8_t n = 0; n < 3; n++)
+            stats.add(exact[n], fast[n]);
+    }
+    return stats;
+}
+
+/** Compile time Colors against setRGB at run time **/
+bool checkConstexprColors()
+{
+    for (uint8_t n = 0; n < CONSTEXPR_COLORS_COUNT; n++)
+    {
+        Color c = color_P(&CONSTEXPR_COLORS[n]);
+        Color runtime;
+        runtime.setRGB(c.red(), c.green(), c.blue());
+        if (c.hue16() != runtime.hue16() || c.saturation16() != runtime.saturation16() || c.value16() != runtime.value16())
+            return false;
+    }
+    return true;
+}
+
+void printResult(bool pass)
+{
+    Serial.println(pass ? " PASS" : " FAIL");
+}
+
+void setup()
+{
+    Serial.begin(baudRate);
+    Serial.println("CONVERSION ACCURACY (max, mean error per channel)");
+
+    for (uint8_t trip = 0; trip < TRIPS_COUNT; trip++)
+    {
+        ErrorStats stats = checkAll(trip);
+        Serial.print(TRIP_NAMES[trip]);
+        Serial.print(": ");
+        Serial.print(stats.max);
+        Serial.print(", ");
+        Serial.print(stats.mean(), 4);
+        printResult(stats.max <= GOLDEN_MAX[trip] && stats.mean() <= GOLDEN_MEAN[trip] + MEAN_TOLERANCE);
+    }
+
+    Serial.print("hue_in_range, binary degrees:");
+    printResult(checkHue());
+
+    uint32_t sum, hash;
+    checkTemperature(sum, hash);
+    Serial.print("temperature_to_rgb sum ");
+    Serial.print(sum);
+    Serial.print(" hash ");
+    Serial.print(hash);
+#if defined(__linux__)
+    printResult(sum == GOLDEN_TEMPERATURE_SUM && hash == GOLDEN_TEMPERATURE_HASH);
+#else
+    Serial.println(" (no golden for this target)");
+#endif
+
+    ErrorStats fast = checkFastTemperature();
+    Serial.print("temperature_to_rgb_fast 1000-40000 K: ");
+    Serial.print(fast.max);
+    Serial.print(", ");
+    Serial.print(fast.mean(), 4);
+    printResult(fast.max <= GOLDEN_FAST_TEMPERATURE_MAX);
+
+    Serial.print("constexpr Color, _rgb literals:");
+    printResult(checkConstexprColors());
+}
+
+void loop()
+{
+}
@@ -7,22 +7,47 @@ void Functions::debugData()
 	printArrayln(_freqs, N);
 	printArrayln(_phases, N);
 }
-Functions::Functions()
+Functions::Functions(const Functions &other) : Functions()
 {
-	resetTimer();
-	setPeriodicData(1, 1, 0);
+	*this = other;
 }
 
+Functions &Functions::operator=(const Functions &other)
+{
+	if (this == &other)
+		return *this;
+	startTime = other.startTime;
+	speed = other.speed;
+	k_param = other.k_param;
+	sampleRate = other.sampleRate;
+	functionType = other.functionType;
+	if (other.isConst)
+		setPeriodicData(other.periodicDataSize, (const float *)other._amps, (const float *)other._freqs, (const float *)other._phases);
+	else
+		setPeriodicData(other.periodicDataSize, other._amps, other._freqs, other._phases);
+	return *this;
+}
+
+void Functions::begin() { resetTimer(); }
+
 Functions::~Functions()
 {
 
 	resetPeriodicData();
 }
 
+TimeSource Functions::timeSource = millis;
+
+void Functions::setTimeSource(TimeSource source) { timeSource = source; }
+
+unsigned long Functions::now() { return timeSource(); }
+
 /** Sets startTime to now mills */
-void Functions::resetTimer() { startTime = millis(); }
+void Functions::resetTimer() { startTime = now(); }
+/** Sets startTime to @time of the shared clock */
+void Functions::resetTimer(unsigned long time) { startTime = time; }
 /* Gets internal function time in milliseconds	(ms)*/
-float Functions::mt() { return speed * ((float)(millis() - startTime)); }
+float Functions::mt() { return speed * ((float)(now() - startTime)); }
 /* Gets internal function time in seconds (s)	 */
 float Functions::t() { return mt() / 1000.0f; }
 
@@ -128,7 +153,7 @@ void Functions::setPeriodicData(uint8_t dataSize, const float *amps, const float
 
 void Functions::clearMemory()
 {
-	if (!isConst)
+	if (!isConst && _amps != &_amp)
 	{
 		if (_amps != NULL)
 		{
@@ -146,6 +171,10 @@ void Functions::clearMemory()
 			// free(_phases);
 		}
 	}
+	_amps = &_amp;
+	_freqs = &_freq;
+	_phases = &_phase;
+	isConst = false;
 }
 
 void Functions::resetPeriodicData(uint8_t newSize)
@@ -158,7 +187,8 @@ void Functions::resetPeriodicData(uint8_t newSize)
 
 	clearMemory();
 
-	if (periodicDataSize != 0)
+	// A single term uses the inline storage
+	if (periodicDataSize > 1)
 	{
 
 		_amps = new float[periodicDataSize];
@@ -172,7 +202,6 @@ void Functions::resetPeriodicData(uint8_t newSize)
 		// _amps = (float *)calloc(periodicDataSize, sizeof(float));
 		// _freqs = (float *)calloc(periodicDataSize, sizeof(float));
 		// _phases = (float *)calloc(periodicDataSize, sizeof(float));
-		isConst = false;
 	}
 }
 
@@ -280,43 +309,13 @@ float Functions::getInCircle(float f)
  */
 float Functions::circleFromTo(float start, float end, float period, bool minDistance)
 {
-
-	// Clockwise
-	float distance = getInCircle(start - end);
-	// Clockwise then sustract from start.
-	float direction = -1.0;
-	// Counterclockwise distance
-	float a = getInCircle(end - start);
-	// Counterclockwise then add from start
-	float b = 1.0;
-
-	if ((minDistance && (a < distance)) || ((!minDistance) && (a > distance)))
-	{
-		swap(distance, a);
-		swap(direction, b);
-	}
-
-	/* Determinar centro, frecuencia y amplitud
-	 * a -> amplitud = direction*distance/.0;
-	 * c = from + amplitud
-	 * freccuencia = (distancia/time)�/2?
-	 */
-
-	// amplitud = direction*distance/.0;
-
-	a = direction * distance / 2.0f;
-	// frequency
-	b = 2.0f * distance / period;
-	//		float c = (start + a);
-
-	return getInCircle((start + a) - a * cos(wt(b)));
+	return circleAround(makeCircleAroundData(start, end, period, minDistance));
 }
 
-CircleAroundData Functions::getCircleAroundData(float start, float end, float period, bool minDistance)
+CircleAroundData Functions::makeCircleAroundData(float start, float end, float period, bool minDistance)
 {
 
 	// Clockwise
-
 	float distance = getInCircle(start - end);
 	// Clockwise then sustract from start.
 	float direction = -1.0;
@@ -331,24 +330,25 @@ CircleAroundData Functions::getCircleAroundData(float start, float end, float pe
 		swap(direction, b);
 	}
 
-	/* Determinar centro, frecuencia y amplitud
-	 * a -> amplitud = direction*distance/.0;
-	 * c = from + amplitud
-	 * freccuencia = (distancia/time)�/2?
+	/* Center, frequency and amplitude
+	 * amplitude = direction * distance / 2
+	 * center = start + amplitude
+	 * frequency = 2 * distance / period, in Hz as circleAround() expects
 	 */
 
-	// amplitud = direction*distance/.0;
-
 	CircleAroundData data;
-	data.amp = distance / 2.0f;
-	// frequenzy
-	data.freq = TWO_PI * distance / period;
-	data.amp *= direction;
+	data.amp = direction * distance / 2.0f;
+	data.freq = 2.0f * distance / period;
 	data.center = start + data.amp;
 
 	return data;
 }
 
+CircleAroundData Functions::getCircleAroundData(float start, float end, float period, bool minDistance)
+{
+	return makeCircleAroundData(start, end, period, minDistance);
+}
+
 /** Periodic oscillation every @period time, the funtion will go from @start to @end and return from @end to start
  * @param start Initial value
  * @param end End value
@@ -357,40 +357,52 @@ CircleAroundData Functions::getCircleAroundData(float start, float end, float pe
  */
 void Functions::setCircleFromTo(float start, float end, float period, bool minDistance)
 {
+	CircleAroundData data = makeCircleAroundData(start, end, period, minDistance);
 
-	// Clockwise
-	float distance = getInCircle(start - end);
-	// Clockwise then sustract from start.
-	float direction = -1.0;
-	// Counterclockwise distance
-	float a = getInCircle(end - start);
-	// Counterclockwise then add from start
-	float b = 1.0;
+	float amps[] = {data.center, data.amp};
+	float freqs[] = {0.0, data.freq};
+	float ph[] = {0.0, PI};
+	functionType = COSINES;
+	setPeriodicData(2, amps, freqs, ph);
+	resetTimer();
+}
 
-	if ((minDistance && (a < distance)) || ((!minDistance) && (a > distance)))
+float Functions::noises(bool simplex, uint8_t size, float *amplitudes, float *freqs, float *phases, uint8_t dims, float x, float y)
+{
+	float tt = t();
+	int32_t out = 0;
+
+	for (uint8_t n = 0; n < size; n++)
 	{
-		swap(distance, a);
-		swap(direction, b);
+		uint32_t z = noise_coord(tt * freqs[n] + phases[n]);
+		uint32_t px = noise_coord(x) << n;
+		uint32_t py = noise_coord(y) << n;
+		int16_t v;
+		if (dims == 1)
+			v = simplex ? simplex_noise(z) : value_noise(z);
+		else if (dims == 2)
+			v = simplex ? simplex_noise(px, z) : value_noise(px, z);
+		else
+			v = simplex ? simplex_noise(px, py, z) : value_noise(px, py, z);
+		// Amplitudes as 8.8 fixed point keep the sum in integers
+		out += ((int32_t)v * (int16_t)(amplitudes[n] * 256.0f)) >> 8;
 	}
 
-	/* Determinar centro, frecuencia y amplitud
-	 * a -> amplitud = direction*distance/.0;
-	 * c = from + amplitud
-	 * frecuencia = (distancia/time)�/2?
-	 */
+	return out / 32767.0f;
+}
 
-	// amplitud = direction*distance/.0;
-	a = direction * distance / 2.0;
-	// frequenzy
-	b = 2.0 * distance / period;
-	//		float c = (start + a);
+float Functions::noiseAt(float x)
+{
+	if (functionType != VALUE_NOISE && functionType != SIMPLEX_NOISE)
+		return value();
+	return noises(functionType == SIMPLEX_NOISE, periodicDataSize, _amps, _freqs, _phases, 2, x);
+}
 
-	float amps[] = {(start + a), a};
-	float freqs[] = {0.0, b};
-	float ph[] = {0.0, PI};
-	functionType = COSINES;
-	setPeriodicData(2, amps, freqs, ph);
-	resetTimer();
+float Functions::noiseAt(float x, float y)
+{
+	if (functionType != VALUE_NOISE && functionType != SIMPLEX_NOISE)
+		return value();
+	return noises(functionType == SIMPLEX_NOISE, periodicDataSize, _amps, _freqs, _phases, 3, x, y);
 }
 
 float Functions::sawtooth(float frequency, float phase0)
@@ -433,6 +445,28 @@ float Functions::sinePulse(float frequency, float phase0, float k)
 	return sinPulseWave(wt(frequency, phase0), k);
 }
 
+float Functions::cyclePhase(float frequency, float phase0)
+{
+	float p = wt(frequency, phase0) / TWO_PI;
+	p -= (long)p;
+	return p < 0 ? p + 1.0f : p;
+}
+
+float Functions::bandLimitedSawtooth(float frequency, float sampleRate, float phase0)
+{
+	return blep_sawtooth(cyclePhase(frequency, phase0), speed * frequency / sampleRate);
+}
+
+float Functions::bandLimitedSquare(float frequency, float sampleRate, float phase0, float k)
+{
+	return blep_square(cyclePhase(frequency, phase0), speed * frequency / sampleRate, k);
+}
+
+float Functions::bandLimitedPulse(float frequency, float sampleRate, float phase0, float k)
+{
+	return blep_pulse(cyclePhase(frequency, phase0), speed * frequency / sampleRate, k);
+}
+
 float Functions::linearMovement(float x0, float v) { return x0 + v * t(); }
 
 void Functions::setFunctionType(uint8_t type) { functionType = type; }
@@ -453,17 +487,29 @@ float Functions::value()
 	case TRIANGULAR:
 		return *_amps * triangular(*_freqs, *_phases, k_param);
 	case SQUARE:
+		if (sampleRate > 0)
+			return *_amps * bandLimitedSquare(*_freqs, sampleRate, *_phases, k_param);
 		return *_amps * square(*_freqs, *_phases, k_param);
 	case PULSE:
+		if (sampleRate > 0)
+			return *_amps * bandLimitedPulse(*_freqs, sampleRate, *_phases, k_param);
 		return *_amps * pulse(*_freqs, *_phases, k_param);
 	case SAWTOOTH:
+		if (sampleRate > 0)
+			return *_amps * bandLimitedSawtooth(*_freqs, sampleRate, *_phases);
 		return *_amps * sawtooth(*_freqs, *_phases);
 	case INVERSE_SAWTOOTH:
+		if (sampleRate > 0)
+			return -*_amps * bandLimitedSawtooth(*_freqs, sampleRate, *_phases);
 		return *_amps * inverseSawtooth(*_freqs, *_phases);
 	case RHOMBOIDAL:
 		return *_amps * rhomboid(*_freqs, *_phases, k_param);
 	case SINE_PULSE:
 		return *_amps * sinePulse(*_freqs, *_phases, k_param);
+	case VALUE_NOISE:
+		return noises(false, periodicDataSize, _amps, _freqs, _phases);
+	case SIMPLEX_NOISE:
+		return noises(true, periodicDataSize, _amps, _freqs, _phases);
 	default:
 		return 0.0F;
 	}
@@ -18,6 +18,8 @@
 
 #include <arduino_utils.h>
 #include <math_utils.h>
+#include "noise.h"
+#include "polyblep.h"
 
 struct PeriodicData
 {
@@ -61,10 +63,16 @@ typedef struct
 
 } CircleAroundData;
 
+/** Clock in milliseconds **/
+typedef unsigned long (*TimeSource)();
+
 class Functions
 {
 
 protected:
+	/** Shared by all instances, millis() by default **/
+	static TimeSource timeSource;
+
 	unsigned long startTime;
 
 	// periodic data
@@ -73,13 +81,17 @@ protected:
 	float *_amps;
 	float *_freqs;
 	float *_phases;
+	/** Single term storage, one term periodic data needs no heap **/
+	float _amp, _freq, _phase;
 
-	/** Free allocated memory **/
+	/** Free allocated memory, periodic data points to the single term again **/
 	void clearMemory();	
 
 public:
 	float speed = 1.0;
 	float k_param = 0.5;
+	/** Rate value() is sampled at in Hz, when set SQUARE, PULSE and the sawtooths are band limited **/
+	float sampleRate = 0;
 	uint8_t functionType;
 
 	// MAX 127
@@ -95,16 +107,41 @@ public:
 		SAWTOOTH,
 		INVERSE_SAWTOOTH,
 		RHOMBOIDAL,
-		SINE_PULSE
+		SINE_PULSE,
+		VALUE_NOISE,
+		SIMPLEX_NOISE
 	} FunctionTypes;
 
-	Functions();
+	/** Constant initialized, global instances need no startup code. The
+	 *  timer starts at 0, begin() starts it at the current time. **/
+	constexpr Functions()
+		: startTime(0), periodicDataSize(1), isConst(false), _amps(&_amp), _freqs(&_freq), _phases(&_phase),
+		  _amp(1), _freq(1), _phase(0), functionType(NO_FUNCTION)
+	{
+	}
+
+	/** Copies the periodic data, a single term into the copy own storage **/
+	Functions(const Functions &other);
+
+	Functions &operator=(const Functions &other);
 
 	virtual ~Functions();
 
+	/** Starts the timer, call from setup() **/
+	void begin();
+
+	/** Sets the clock of all Functions, e.g. a synced one so several fixtures keep in step **/
+	static void setTimeSource(TimeSource source);
+
+	/** Current time of the shared clock in milliseconds **/
+	static unsigned long now();
+
 	/** Reset internal timer to current time */
 	void resetTimer();
 
+	/** Reset internal timer to @time of the shared clock */
+	void resetTimer(unsigned long time);
+
 	/* Get internal function time in milliseconds	(ms)*/
 	float mt();
 
@@ -186,7 +223,7 @@ public:
 	/**
 	 * Maps a value in the range [0,1) ????
 	 */
-	float getInCircle(float f);
+	static float getInCircle(float f);
 
 	/** Periodic oscillation every @period time, the funtion will go from @start to @end and return from @end to start
 	 * @param start Initial value
@@ -198,6 +235,9 @@ public:
 
 	CircleAroundData getCircleAroundData(float start, float end, float period, bool minDistance = false);
 
+	/** Center, amplitude and frequency (Hz) of the oscillation circleFromTo() does, shared by the circle methods and HueOrbit **/
+	static CircleAroundData makeCircleAroundData(float start, float end, float period, bool minDistance = false);
+
 	/** Periodic oscillation every @period time, the funtion will go from @start to @end and return from @end to start
 	 * @param start Initial value
 	 * @param end End value
@@ -206,6 +246,22 @@ public:
 	 */
 	void setCircleFromTo(float start, float end, float period, bool minDistance = false);
 
+	/** Noise octaves addition, about [-1,1] per unit of amplitude
+	 * @param simplex Simplex noise if true, value noise otherwise
+	 * @param size Number of octaves
+	 * @param amplitudes Amplitude of each octave.
+	 * @param freqs Lattice cells per second of each octave.
+	 * @param phases Lattice offset of each octave, different offsets work as different seeds.
+	 * @param dims 1 for time only, 2 adds @x and 3 adds @x and @y. Octave n scales them by 2^n.
+	 */
+	float noises(bool simplex, uint8_t size, float *amplitudes, float *freqs, float *phases, uint8_t dims = 1, float x = 0, float y = 0);
+
+	/** Noise function value at position @x in lattice cells, e.g. pixel index * cells per pixel **/
+	float noiseAt(float x);
+
+	/** Noise function value at position @x,@y in lattice cells **/
+	float noiseAt(float x, float y);
+
 	// WAVE FORMS
 	float sawtooth(float frequency, float phase0 = 0);
 	float inverseSawtooth(float frequency, float phase0 = 0);
@@ -216,6 +272,14 @@ public:
 	float rhomboid(float frequency, float phase0 = 0, float k = 0.5);
 	float sinePulse(float frequency, float phase0 = 0, float k = 0.5);
 
+	// BAND LIMITED WAVE FORMS, for @sampleRate samples per second
+	float bandLimitedSawtooth(float frequency, float sampleRate, float phase0 = 0);
+	float bandLimitedSquare(float frequency, float sampleRate, float phase0 = 0, float k = 0.5);
+	float bandLimitedPulse(float frequency, float sampleRate, float phase0 = 0, float k = 0.5);
+
+	/** Cycle position [0,1) for @frequency and initial phase @phase0 in radians **/
+	float cyclePhase(float frequency, float phase0 = 0);
+
 	// LINEAR MOVEMENT
 	float linearMovement(float x0, float v);
 
@@ -226,4 +290,64 @@ public:
 	void debugData();
 };
 
+/** circleFromTo() with its CircleAroundData cached, only recomputed when
+ *  start, end, period or minDistance change. A tick is a cosine and a wrap,
+ *  cheap enough per pixel and frame. **/
+class HueOrbit
+{
+
+protected:
+	float _start, _end, _period;
+	bool _minDistance;
+	CircleAroundData _data;
+
+public:
+	HueOrbit() : _start(0), _end(0), _period(1), _minDistance(false)
+	{
+		_data = Functions::makeCircleAroundData(_start, _end, _period, _minDistance);
+	}
+
+	HueOrbit(float start, float end, float period, bool minDistance = false) : HueOrbit()
+	{
+		set(start, end, period, minDistance);
+	}
+
+	/** @start and @end in [0,1), @period in seconds **/
+	void set(float start, float end, float period, bool minDistance = false)
+	{
+		if (start == _start && end == _end && period == _period && minDistance == _minDistance)
+			return;
+		_start = start;
+		_end = end;
+		_period = period;
+		_minDistance = minDistance;
+		_data = Functions::makeCircleAroundData(start, end, period, minDistance);
+	}
+
+	/** Sets hues in degrees **/
+	void setHues(uint16_t startHue, uint16_t endHue, float period, bool minDistance = false)
+	{
+		set(startHue / 360.0f, endHue / 360.0f, period, minDistance);
+	}
+
+	const CircleAroundData &data() { return _data; }
+
+	/** Position [0,1) at @t seconds **/
+	float value(float t)
+	{
+		float v = _data.center - _data.amp * cos(TWO_PI * _data.freq * t);
+		return v - floor(v);
+	}
+
+	/** Position at the internal time of @clock, same as clock.circleFromTo() **/
+	float value(Functions &clock) { return value(clock.t()); }
+
+	/** Hue [0,359] at @t seconds **/
+	uint16_t hue(float t)
+	{
+		uint16_t h = value(t) * 360.0f;
+		return h < 360 ? h : 0;
+	}
+};
+
 #endif /* FUNCTIONS_H_ */
@@ -0,0 +1,152 @@
+/*
+ * gradient.h
+ *
+ * Multi stop gradients baked once into a 256 entry table, so a value in
+ * [0,1] maps to a color with a single index.
+ */
+
+#ifndef GRADIENT_H_
+#define GRADIENT_H_
+
+#include "Arduino.h"
+#include "rgb_utils.h"
+#include "palette.h"
+
+/** Gradient stop, @position [0,255]. Aggregate so stop arrays can live in flash:
+ *  const GradientStop stops[] PROGMEM = {{0, COLOR_BLACK}, {255, COLOR_AMBER}};
+ **/
+struct GradientStop
+{
+	uint8_t position;
+	uint8_t red;
+	uint8_t green;
+	uint8_t blue;
+
+	static GradientStop make(uint8_t position, RGBOutput color)
+	{
+		GradientStop s = {position, color.red, color.green, color.blue};
+		return s;
+	}
+};
+
+class GradientTable : public ColorPalette<256>
+{
+
+protected:
+	/** Fills entries [from.position, to.position] stepping each channel in 8.8 fixed point, one divide per channel **/
+	void segment(const GradientStop &from, const GradientStop &to)
+	{
+		uint8_t length = to.position - from.position;
+		if (length == 0)
+		{
+			set(to.position, to.red, to.green, to.blue);
+			return;
+		}
+
+		// 32 bit products, int is 16 bits on AVR. Steps and values wrap alike mod 2^16.
+		int16_t steps[3] = {(int16_t)((((int32_t)to.red - from.red) * 256) / length),
+							(int16_t)((((int32_t)to.green - from.green) * 256) / length),
+							(int16_t)((((int32_t)to.blue - from.blue) * 256) / length)};
+		uint16_t values[3] = {(uint16_t)(from.red << 8), (uint16_t)(from.green << 8), (uint16_t)(from.blue << 8)};
+
+		for (uint16_t e = from.position; e < to.position; e++)
+		{
+			set(e, values[0] >> 8, values[1] >> 8, values[2] >> 8);
+			for (uint8_t c = 0; c < 3; c++)
+				values[c] += steps[c];
+		}
+		set(to.position, to.red, to.green, to.blue);
+	}
+
+public:
+	/** Bakes @count stops sorted by position. Entries before the first stop and after the last one take their colors. **/
+	void bake(const GradientStop *stops, uint8_t count)
+	{
+		if (count == 0)
+			return;
+
+		for (uint16_t e = 0; e < stops[0].position; e++)
+			set(e, stops[0].red, stops[0].green, stops[0].blue);
+
+		for (uint8_t n = 1; n < count; n++)
+			segment(stops[n - 1], stops[n]);
+
+		const GradientStop &last = stops[count - 1];
+		for (uint16_t e = last.position; e < 256; e++)
+			set(e, last.red, last.green, last.blue);
+	}
+
+	/** Bakes stops stored in PROGMEM **/
+	void bake_P(const GradientStop *stops, uint8_t count)
+	{
+		if (count == 0)
+			return;
+
+		GradientStop from, to;
+		memcpy_P(&from, &stops[0], sizeof(GradientStop));
+		GradientStop first = from;
+		for (uint16_t e = 0; e < first.position; e++)
+			set(e, first.red, first.green, first.blue);
+
+		for (uint8_t n = 1; n < count; n++)
+		{
+			memcpy_P(&to, &stops[n], sizeof(GradientStop));
+			segment(from, to);
+			from = to;
+		}
+
+		for (uint16_t e = from.position; e < 256; e++)
+			set(e, from.red, from.green, from.blue);
+	}
+
+	/** Color of @value in [0,1], values out of range are clamped **/
+	RGBOutput map(float value) const
+	{
+		if (value <= 0.0f)
+			return color(0);
+		if (value >= 1.0f)
+			return color(255);
+		return color((uint8_t)(value * 255.0f + 0.5f));
+	}
+
+	/** Color of @value in [@min,@max], e.g. Functions::value() in [-1,1] **/
+	RGBOutput map(float value, float min, float max) const { return map((value - min) / (max - min)); }
+
+	/** Black, glowing reds and candle light to warm white **/
+	void fire()
+	{
+		GradientStop stops[] = {
+			GradientStop::make(0, RGBOutput(0, 0, 0)),
+			GradientStop::make(64, RGBOutput::FROM_TEMPERATURE(ColorTone::low_limit, 160)),
+			GradientStop::make(140, RGBOutput::FROM_TEMPERATURE(ColorTone::candle)),
+			GradientStop::make(210, RGBOutput::FROM_TEMPERATURE(ColorTone::warm)),
+			GradientStop::make(255, RGBOutput::FROM_TEMPERATURE(ColorTone::neutral))};
+		bake(stops, 5);
+	}
+
+	/** Deep blue through azure and cyan to cold white foam **/
+	void ocean()
+	{
+		GradientStop stops[] = {
+			GradientStop::make(0, RGBOutput::FROM_HSV(ColorTone::blue, 255, 60)),
+			GradientStop::make(96, RGBOutput::FROM_HSV(ColorTone::blue, 255, 200)),
+			GradientStop::make(176, RGBOutput::FROM_HSV(ColorTone::azure, 255, 255)),
+			GradientStop::make(232, RGBOutput::FROM_HSV(ColorTone::cyan, 200, 255)),
+			GradientStop::make(255, RGBOutput::FROM_TEMPERATURE(ColorTone::cold))};
+		bake(stops, 5);
+	}
+
+	/** Dusk violet through sunset to warm tungsten light **/
+	void sunset()
+	{
+		GradientStop stops[] = {
+			GradientStop::make(0, RGBOutput::FROM_HSV(ColorTone::violet, 255, 80)),
+			GradientStop::make(80, RGBOutput::FROM_HSV(ColorTone::magenta, 220, 160)),
+			GradientStop::make(150, RGBOutput::FROM_TEMPERATURE(ColorTone::sunset)),
+			GradientStop::make(210, RGBOutput::FROM_TEMPERATURE(ColorTone::warm)),
+			GradientStop::make(255, RGBOutput::FROM_TEMPERATURE(ColorTone::tungsten120))};
+		bake(stops, 5);
+	}
+};
+
+#endif /* GRADIENT_H_ */
@@ -0,0 +1,201 @@
+/*
+ * modulation.h
+ *
+ * Modulation matrix: Functions outputs drive speed, k_param or amp of other
+ * Functions. Routes are sorted once by resolve() into a flat evaluation order,
+ * so each frame evaluates every node once and sources before their destinations.
+ */
+
+#ifndef MODULATION_H_
+#define MODULATION_H_
+
+#include <Arduino.h>
+#include "color_animation.h"
+
+typedef enum
+{
+	MOD_SPEED,
+	MOD_K_PARAM,
+	/** AnimationFunctions destinations only **/
+	MOD_AMP
+} ModulationTarget;
+
+struct ModulationRoute
+{
+	uint8_t source;
+	uint8_t destination;
+	uint8_t target;
+	/** First route of its destination parameter, starts from base **/
+	bool first;
+	float base;
+	float depth;
+};
+
+class ModulationMatrix
+{
+
+protected:
+	Functions **_nodes;
+	bool *_animation;
+	float *_values;
+	uint8_t *_order;
+	/** Pending sources while resolving, then position in _order **/
+	uint8_t *_rank;
+	uint8_t _count;
+	uint8_t _maxNodes;
+
+	ModulationRoute *_routes;
+	uint8_t _routeCount;
+	uint8_t _maxRoutes;
+	bool _resolved;
+
+	int16_t addNode(Functions *f, bool animation)
+	{
+		if (_count >= _maxNodes)
+			return -1;
+		_nodes[_count] = f;
+		_animation[_count] = animation;
+		_values[_count] = 0;
+		_resolved = false;
+		return _count++;
+	}
+
+	float *parameter(uint8_t node, uint8_t target)
+	{
+		Functions *f = _nodes[node];
+		switch (target)
+		{
+		case MOD_SPEED:
+			return &f->speed;
+		case MOD_K_PARAM:
+			return &f->k_param;
+		default:
+			return _animation[node] ? &((AnimationFunctions *)f)->amp : NULL;
+		}
+	}
+
+public:
+	ModulationMatrix(uint8_t maxNodes = 8, uint8_t maxRoutes = 8)
+		: _count(0), _maxNodes(maxNodes), _routeCount(0), _maxRoutes(maxRoutes), _resolved(false)
+	{
+		_nodes = new Functions *[maxNodes];
+		_animation = new bool[maxNodes];
+		_values = new float[maxNodes];
+		_order = new uint8_t[maxNodes];
+		_rank = new uint8_t[maxNodes];
+		_routes = new ModulationRoute[maxRoutes];
+	}
+
+	/** Owns its arrays, copies would free them twice **/
+	ModulationMatrix(const ModulationMatrix &) = delete;
+	ModulationMatrix &operator=(const ModulationMatrix &) = delete;
+
+	virtual ~ModulationMatrix()
+	{
+		delete[] _nodes;
+		delete[] _animation;
+		delete[] _values;
+		delete[] _order;
+		delete[] _rank;
+		delete[] _routes;
+	}
+
+	/** Adds a node evaluated by value(), @return its index or -1 if full.
+	 *  Chosen by the static type: an AnimationFunctions passed as Functions *
+	 *  is a plain node, without MOD_AMP and output(). **/
+	int16_t add(Functions *f) { return addNode(f, false); }
+
+	/** Adds a node evaluated by output(), its amp can be modulated **/
+	int16_t add(AnimationFunctions *f) { return addNode(f, true); }
+
+	/** @destination parameter = @base + @depth * @source value, routes to the same parameter add up.
+	 *  @return false if full or invalid **/
+	bool route(uint8_t source, uint8_t destination, uint8_t target, float depth, float base)
+	{
+		if (_routeCount >= _maxRoutes || source >= _count || destination >= _count || parameter(destination, target) == NULL)
+			return false;
+		ModulationRoute &r = _routes[_routeCount++];
+		r.source = source;
+		r.destination = destination;
+		r.target = target;
+		r.depth = depth;
+		r.base = base;
+		_resolved = false;
+		return true;
+	}
+
+	/** Sorts nodes so sources go first and routes by destination. @return false on a cycle **/
+	bool resolve()
+	{
+		uint8_t *pending = _rank;
+		uint8_t *rank = _rank;
+		memset(pending, 0, _count);
+		for (uint8_t r = 0; r < _routeCount; r++)
+			pending[_routes[r].destination]++;
+
+		// Kahn's algorithm, a node is ready when all its sources are placed
+		uint8_t placed = 0;
+		for (uint8_t n = 0; n < _count; n++)
+			if (pending[n] == 0)
+				_order[placed++] = n;
+		for (uint8_t i = 0; i < placed; i++)
+		{
+			for (uint8_t r = 0; r < _routeCount; r++)
+				if (_routes[r].source == _order[i] && --pending[_routes[r].destination] == 0)
+					_order[placed++] = _routes[r].destination;
+		}
+		if (placed < _count)
+			return _resolved = false;
+
+		for (uint8_t i = 0; i < _count; i++)
+			rank[_order[i]] = i;
+
+		// Stable insertion sort of routes by destination rank
+		for (uint8_t i = 1; i < _routeCount; i++)
+		{
+			ModulationRoute r = _routes[i];
+			uint8_t j = i;
+			for (; j > 0 && rank[_routes[j - 1].destination] > rank[r.destination]; j--)
+				_routes[j] = _routes[j - 1];
+			_routes[j] = r;
+		}
+		for (uint8_t i = 0; i < _routeCount; i++)
+		{
+			_routes[i].first = true;
+			for (uint8_t j = 0; j < i; j++)
+				if (_routes[j].destination == _routes[i].destination && _routes[j].target == _routes[i].target)
+					_routes[i].first = false;
+		}
+		return _resolved = true;
+	}
+
+	bool isResolved() { return _resolved; }
+
+	/** Evaluates every node once, applying its incoming routes first. Nothing is done while there is a cycle. **/
+	void update()
+	{
+		if (!_resolved && !resolve())
+			return;
+
+		uint8_t r = 0;
+		for (uint8_t i = 0; i < _count; i++)
+		{
+			uint8_t n = _order[i];
+			// Routes are sorted, the ones of this node are next
+			for (; r < _routeCount && _routes[r].destination == n; r++)
+			{
+				float *p = parameter(n, _routes[r].target);
+				float v = _routes[r].depth * _values[_routes[r].source];
+				*p = _routes[r].first ? _routes[r].base + v : *p + v;
+			}
+			_values[n] = _animation[n] ? ((AnimationFunctions *)_nodes[n])->output() : _nodes[n]->value();
+		}
+	}
+
+	/** Value of @node in the last update **/
+	float value(uint8_t node) { return _values[node]; }
+
+	uint8_t nodes() { return _count; }
+};
+
+#endif /* MODULATION_H_ */
@@ -0,0 +1,249 @@
+#include "noise.h"
+
+// Ken Perlin's permutation
+static const uint8_t NOISE_PERM[256] PROGMEM = {
+    151, 160, 137, 91, 90, 15, 131, 13, 201, 95, 96, 53, 194, 233, 7, 225,
+    140, 36, 103, 30, 69, 142, 8, 99, 37, 240, 21, 10, 23, 190, 6, 148,
+    247, 120, 234, 75, 0, 26, 197, 62, 94, 252, 219, 203, 117, 35, 11, 32,
+    57, 177, 33, 88, 237, 149, 56, 87, 174, 20, 125, 136, 171, 168, 68, 175,
+    74, 165, 71, 134, 139, 48, 27, 166, 77, 146, 158, 231, 83, 111, 229, 122,
+    60, 211, 133, 230, 220, 105, 92, 41, 55, 46, 245, 40, 244, 102, 143, 54,
+    65, 25, 63, 161, 1, 216, 80, 73, 209, 76, 132, 187, 208, 89, 18, 169,
+    200, 196, 135, 130, 116, 188, 159, 86, 164, 100, 109, 198, 173, 186, 3, 64,
+    52, 217, 226, 250, 124, 123, 5, 202, 38, 147, 118, 126, 255, 82, 85, 212,
+    207, 206, 59, 227, 47, 16, 58, 17, 182, 189, 28, 42, 223, 183, 170, 213,
+    119, 248, 152, 2, 44, 154, 163, 70, 221, 153, 101, 155, 167, 43, 172, 9,
+    129, 22, 39, 253, 19, 98, 108, 110, 79, 113, 224, 232, 178, 185, 112, 104,
+    218, 246, 97, 228, 251, 34, 242, 193, 238, 210, 144, 12, 191, 179, 162, 241,
+    81, 51, 145, 235, 249, 14, 239, 107, 49, 192, 214, 31, 181, 199, 106, 157,
+    184, 84, 204, 176, 115, 121, 50, 45, 127, 4, 150, 254, 138, 236, 205, 93,
+    222, 114, 67, 29, 24, 72, 243, 141, 128, 195, 78, 66, 215, 61, 156, 180};
+
+// Edge midpoints of a cube, the first 8 are also used in 2D
+static const int8_t NOISE_GRAD3[12][3] PROGMEM = {
+    {1, 1, 0}, {-1, 1, 0}, {1, -1, 0}, {-1, -1, 0},
+    {1, 0, 1}, {-1, 0, 1}, {1, 0, -1}, {-1, 0, -1},
+    {0, 1, 1}, {0, -1, 1}, {0, 1, -1}, {0, -1, -1}};
+
+// 12 fractional bits inside the simplex kernels
+#define NOISE_FRAC 12
+#define NOISE_ONE (1L << NOISE_FRAC)
+
+static inline uint8_t perm(uint8_t i) { return pgm_read_byte(&NOISE_PERM[i]); }
+
+static inline uint8_t hash(uint8_t i) { return perm(i); }
+static inline uint8_t hash(uint8_t i, uint8_t j) { return perm(perm(i) + j); }
+static inline uint8_t hash(uint8_t i, uint8_t j, uint8_t k) { return perm(perm(perm(i) + j) + k); }
+
+static inline int16_t clamp16(int32_t v)
+{
+    return v > 32767 ? 32767 : (v < -32767 ? -32767 : v);
+}
+
+// VALUE NOISE
+
+/** 3t^2 - 2t^3 on [0,255] **/
+static inline uint8_t fade8(uint8_t t)
+{
+    return ((uint32_t)t * t * (768 - 2 * t)) >> 16;
+}
+
+static inline int16_t lerp16(int16_t a, int16_t b, uint8_t t)
+{
+    return a + (((int32_t)b - a) * t >> 8);
+}
+
+/** Lattice value, [-32768,32512] **/
+static inline int16_t lattice(uint8_t h) { return (int16_t)((int8_t)h) * 256; }
+
+int16_t value_noise(uint32_t x)
+{
+    uint8_t i = x >> 16;
+    uint8_t fx = fade8(x >> 8);
+    return lerp16(lattice(hash(i)), lattice(hash(i + 1)), fx);
+}
+
+int16_t value_noise(uint32_t x, uint32_t y)
+{
+    uint8_t i = x >> 16, j = y >> 16;
+    uint8_t fx = fade8(x >> 8), fy = fade8(y >> 8);
+    int16_t a = lerp16(lattice(hash(i, j)), lattice(hash(i + 1, j)), fx);
+    int16_t b = lerp16(lattice(hash(i, j + 1)), lattice(hash(i + 1, j + 1)), fx);
+    return lerp16(a, b, fy);
+}
+
+int16_t value_noise(uint32_t x, uint32_t y, uint32_t z)
+{
+    uint8_t i = x >> 16, j = y >> 16, k = z >> 16;
+    uint8_t fx = fade8(x >> 8), fy = fade8(y >> 8), fz = fade8(z >> 8);
+    int16_t a = lerp16(lattice(hash(i, j, k)), lattice(hash(i + 1, j, k)), fx);
+    int16_t b = lerp16(lattice(hash(i, j + 1, k)), lattice(hash(i + 1, j + 1, k)), fx);
+    int16_t c = lerp16(lattice(hash(i, j, k + 1)), lattice(hash(i + 1, j, k + 1)), fx);
+    int16_t d = lerp16(lattice(hash(i, j + 1, k + 1)), lattice(hash(i + 1, j + 1, k + 1)), fx);
+    return lerp16(lerp16(a, b, fy), lerp16(c, d, fy), fz);
+}
+
+// SIMPLEX NOISE
+
+/** t^4 with 16 fractional bits, @t [0,NOISE_ONE] **/
+static inline int32_t pow4(int32_t t)
+{
+    t = (t * t) >> NOISE_FRAC;
+    return (t * t) >> (2 * NOISE_FRAC - 16);
+}
+
+/** Gradient dot offset, offsets with NOISE_FRAC bits **/
+static inline int32_t grad(uint8_t h, int32_t x, int32_t y)
+{
+    const int8_t *g = NOISE_GRAD3[h & 7];
+    return (int8_t)pgm_read_byte(&g[0]) * x + (int8_t)pgm_read_byte(&g[1]) * y;
+}
+
+static inline int32_t grad(uint8_t h, int32_t x, int32_t y, int32_t z)
+{
+    const int8_t *g = NOISE_GRAD3[h % 12];
+    return (int8_t)pgm_read_byte(&g[0]) * x + (int8_t)pgm_read_byte(&g[1]) * y + (int8_t)pgm_read_byte(&g[2]) * z;
+}
+
+/** Contribution of a corner with falloff @r2 - |offset|^2, 16 fractional bits **/
+static inline int32_t corner(int32_t r2, int32_t d2, int32_t g)
+{
+    int32_t t = r2 - d2;
+    return t <= 0 ? 0 : (pow4(t) * g) >> NOISE_FRAC;
+}
+
+/** @v * @f, @f with 16 fractional bits, split to stay in 32 bits **/
+static inline int32_t fmul(int32_t v, int32_t f)
+{
+    return (v >> 16) * f + (((v & 0xFFFF) * f) >> 16);
+}
+
+/** 16.16 coordinate to NOISE_FRAC bits, keeps 28 bits **/
+static inline int32_t kernel_coord(uint32_t v) { return (int32_t)(v >> (16 - NOISE_FRAC)); }
+
+int16_t simplex_noise(uint32_t x)
+{
+    int32_t X = kernel_coord(x);
+    int32_t i = X >> NOISE_FRAC;
+    int32_t x0 = X & (NOISE_ONE - 1);
+    int32_t x1 = x0 - NOISE_ONE;
+
+    // Gradients 1..8 with sign
+    uint8_t h0 = hash(i), h1 = hash(i + 1);
+    int32_t g0 = (1 + (h0 & 7)) * x0;
+    int32_t g1 = (1 + (h1 & 7)) * x1;
+    if (h0 & 8)
+        g0 = -g0;
+    if (h1 & 8)
+        g1 = -g1;
+
+    int32_t n = corner(NOISE_ONE, (x0 * x0) >> NOISE_FRAC, g0) + corner(NOISE_ONE, (x1 * x1) >> NOISE_FRAC, g1);
+    // 0.395 * n * 32767 / 65536
+    return clamp16((n * 809) >> 12);
+}
+
+// Skew and unskew factors with 16 fractional bits, far cells need the precision.
+// (sqrt(3)-1)/2 and (3-sqrt(3))/6
+#define F2 23987
+#define G2 13849
+// 1/3 and 1/6
+#define F3 21845
+#define G3 10923
+// Unskew offsets of the corners with NOISE_FRAC bits
+#define G2_OFFSET (G2 >> (16 - NOISE_FRAC))
+#define G3_OFFSET (G3 >> (16 - NOISE_FRAC))
+
+int16_t simplex_noise(uint32_t x, uint32_t y)
+{
+    int32_t X = kernel_coord(x), Y = kernel_coord(y);
+    int32_t s = fmul(X + Y, F2);
+    int32_t i = (X + s) >> NOISE_FRAC;
+    int32_t j = (Y + s) >> NOISE_FRAC;
+    int32_t t = fmul((i + j) << NOISE_FRAC, G2);
+
+    int32_t x0 = X - (i << NOISE_FRAC) + t;
+    int32_t y0 = Y - (j << NOISE_FRAC) + t;
+
+    // Lower or upper triangle of the cell
+    int32_t i1 = x0 > y0 ? 1 : 0;
+    int32_t j1 = 1 - i1;
+
+    int32_t x1 = x0 - (i1 << NOISE_FRAC) + G2_OFFSET;
+    int32_t y1 = y0 - (j1 << NOISE_FRAC) + G2_OFFSET;
+    int32_t x2 = x0 - NOISE_ONE + 2 * G2_OFFSET;
+    int32_t y2 = y0 - NOISE_ONE + 2 * G2_OFFSET;
+
+    // Falloff radius^2 0.5
+    const int32_t r2 = NOISE_ONE / 2;
+    int32_t n = corner(r2, (x0 * x0 + y0 * y0) >> NOISE_FRAC, grad(hash(i, j), x0, y0));
+    n += corner(r2, (x1 * x1 + y1 * y1) >> NOISE_FRAC, grad(hash(i + i1, j + j1), x1, y1));
+    n += corner(r2, (x2 * x2 + y2 * y2) >> NOISE_FRAC, grad(hash(i + 1, j + 1), x2, y2));
+    // 70 * n * 32767 / 65536
+    return clamp16(n * 35);
+}
+
+int16_t simplex_noise(uint32_t x, uint32_t y, uint32_t z)
+{
+    int32_t X = kernel_coord(x), Y = kernel_coord(y), Z = kernel_coord(z);
+    int32_t s = fmul(X + Y + Z, F3);
+    int32_t i = (X + s) >> NOISE_FRAC;
+    int32_t j = (Y + s) >> NOISE_FRAC;
+    int32_t k = (Z + s) >> NOISE_FRAC;
+    int32_t t = fmul((i + j + k) << NOISE_FRAC, G3);
+
+    int32_t x0 = X - (i << NOISE_FRAC) + t;
+    int32_t y0 = Y - (j << NOISE_FRAC) + t;
+    int32_t z0 = Z - (k << NOISE_FRAC) + t;
+
+    // Second and third corners by the order of the offsets
+    uint8_t i1, j1, k1, i2, j2, k2;
+    if (x0 >= y0)
+    {
+        if (y0 >= z0)
+        {
+            i1 = 1, j1 = 0, k1 = 0, i2 = 1, j2 = 1, k2 = 0;
+        }
+        else if (x0 >= z0)
+        {
+            i1 = 1, j1 = 0, k1 = 0, i2 = 1, j2 = 0, k2 = 1;
+        }
+        else
+        {
+            i1 = 0, j1 = 0, k1 = 1, i2 = 1, j2 = 0, k2 = 1;
+        }
+    }
+    else
+    {
+        if (y0 < z0)
+        {
+            i1 = 0, j1 = 0, k1 = 1, i2 = 0, j2 = 1, k2 = 1;
+        }
+        else if (x0 < z0)
+        {
+            i1 = 0, j1 = 1, k1 = 0, i2 = 0, j2 = 1, k2 = 1;
+        }
+        else
+        {
+            i1 = 0, j1 = 1, k1 = 0, i2 = 1, j2 = 1, k2 = 0;
+        }
+    }
+
+    int32_t x1 = x0 - ((int32_t)i1 << NOISE_FRAC) + G3_OFFSET;
+    int32_t y1 = y0 - ((int32_t)j1 << NOISE_FRAC) + G3_OFFSET;
+    int32_t z1 = z0 - ((int32_t)k1 << NOISE_FRAC) + G3_OFFSET;
+    int32_t x2 = x0 - ((int32_t)i2 << NOISE_FRAC) + 2 * G3_OFFSET;
+    int32_t y2 = y0 - ((int32_t)j2 << NOISE_FRAC) + 2 * G3_OFFSET;
+    int32_t z2 = z0 - ((int32_t)k2 << NOISE_FRAC) + 2 * G3_OFFSET;
+    int32_t x3 = x0 - NOISE_ONE + 3 * G3_OFFSET;
+    int32_t y3 = y0 - NOISE_ONE + 3 * G3_OFFSET;
+    int32_t z3 = z0 - NOISE_ONE + 3 * G3_OFFSET;
+
+    // Falloff radius^2 0.5, 0.6 leaves small steps at the simplex borders
+    const int32_t r2 = NOISE_ONE / 2;
+    int32_t n = corner(r2, (x0 * x0 + y0 * y0 + z0 * z0) >> NOISE_FRAC, grad(hash(i, j, k), x0, y0, z0));
+    n += corner(r2, (x1 * x1 + y1 * y1 + z1 * z1) >> NOISE_FRAC, grad(hash(i + i1, j + j1, k + k1), x1, y1, z1));
+    n += corner(r2, (x2 * x2 + y2 * y2 + z2 * z2) >> NOISE_FRAC, grad(hash(i + i2, j + j2, k + k2), x2, y2, z2));
+    n += corner(r2, (x3 * x3 + y3 * y3 + z3 * z3) >> NOISE_FRAC, grad(hash(i + 1, j + 1, k + 1), x3, y3, z3));
+    // 76 * n * 32767 / 65536
+    return clamp16(n * 38);
+}
@@ -0,0 +1,33 @@
+/*
+ * noise.h
+ *
+ * Fixed point value and simplex noise in 1, 2 and 3 dimensions.
+ * Coordinates are 16.16 fixed point in lattice cells, results are [-32767,32767].
+ * Patterns repeat every 256 cells of the lattice, no floats are used.
+ */
+
+#ifndef NOISE_H_
+#define NOISE_H_
+
+#include <Arduino.h>
+
+/** Float cells to 16.16 fixed point noise coordinate. Whole cells wrap at
+ *  65536, a multiple of the lattice period, so large times stay defined. **/
+inline uint32_t noise_coord(float cells)
+{
+	float cell = floor(cells);
+	uint32_t whole = (int32_t)fmod(cell, 65536.0f);
+	return (whole << 16) + (uint32_t)((cells - cell) * 65536.0f);
+}
+
+/** Lattice values smoothly interpolated **/
+int16_t value_noise(uint32_t x);
+int16_t value_noise(uint32_t x, uint32_t y);
+int16_t value_noise(uint32_t x, uint32_t y, uint32_t z);
+
+/** Simplex noise, gradients from a table **/
+int16_t simplex_noise(uint32_t x);
+int16_t simplex_noise(uint32_t x, uint32_t y);
+int16_t simplex_noise(uint32_t x, uint32_t y, uint32_t z);
+
+#endif /* NOISE_H_ */
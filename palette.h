@@ -0,0 +1,170 @@
+/*
+ * palette.h
+ *
+ * Palette indexed colors: pixels hold an 8 bit index into a 16 or 256 color
+ * palette and are expanded to RGB only when sent.
+ */
+
+#ifndef PALETTE_H_
+#define PALETTE_H_
+
+#include "Arduino.h"
+#include "rgb_utils.h"
+#include "rgb_strip.h"
+
+/** Palette of N (16 or 256) colors read by 8 bit indices.
+ *  With 16 entries the high nibble of the index selects the entry and the low
+ *  nibble blends towards the next one, wrapping from the last to the first.
+ **/
+template <uint16_t N>
+class ColorPalette
+{
+
+protected:
+	uint8_t _rgb[N][3];
+
+public:
+	static const uint16_t SIZE = N;
+
+	ColorPalette() { memset(_rgb, 0, sizeof(_rgb)); }
+
+	void set(uint8_t entry, uint8_t red, uint8_t green, uint8_t blue)
+	{
+		_rgb[entry][0] = red;
+		_rgb[entry][1] = green;
+		_rgb[entry][2] = blue;
+	}
+
+	void set(uint8_t entry, RGBOutput color) { set(entry, color.red, color.green, color.blue); }
+
+	RGBOutput entry(uint8_t entry) const { return RGBOutput(_rgb[entry][0], _rgb[entry][1], _rgb[entry][2]); }
+
+	static inline uint8_t component(const uint8_t (*colors)[3], uint8_t n, uint8_t c) { return colors[n][c]; }
+
+	static inline uint8_t component(const RGBOutput *colors, uint8_t n, uint8_t c)
+	{
+		return c == 0 ? colors[n].red : (c == 1 ? colors[n].green : colors[n].blue);
+	}
+
+	/** Spreads @count colors evenly over the palette blending between them.
+	 *  @colors e.g. {{COLOR_RED}, {COLOR_AMBER}, {COLOR_BLUE}} or an RGBOutput array
+	 *  @wrap If true the last color blends back to the first, for rotating indices.
+	 **/
+	template <class T>
+	void fromColors(const T *colors, uint8_t count, bool wrap = true)
+	{
+		if (count == 0)
+			return;
+		uint8_t segments = wrap || count == 1 ? count : count - 1;
+		for (uint16_t e = 0; e < N; e++)
+		{
+			// Position in 8.8 fixed point along the colors
+			uint16_t position = ((uint32_t)e * segments << 8) / (wrap ? N : N - 1);
+			uint8_t from = position >> 8;
+			uint8_t to = from + 1 < count ? from + 1 : (wrap ? 0 : from);
+			if (from >= count)
+				from = to = count - 1;
+			for (uint8_t c = 0; c < 3; c++)
+				_rgb[e][c] = blend8(component(colors, from, c), component(colors, to, c), position & 0xFF);
+		}
+	}
+
+	/** Copies the color of @index to @rgb **/
+	inline void lookup(uint8_t index, uint8_t *rgb) const
+	{
+		if (N == 256)
+		{
+			memcpy(rgb, _rgb[index], 3);
+		}
+		else
+		{
+			uint8_t e = index >> 4;
+			uint8_t next = (e + 1) & 0x0F;
+			uint8_t amount = (index & 0x0F) << 4;
+			for (uint8_t c = 0; c < 3; c++)
+				rgb[c] = blend8(_rgb[e][c], _rgb[next][c], amount);
+		}
+	}
+
+	RGBOutput color(uint8_t index) const
+	{
+		uint8_t rgb[3];
+		lookup(index, rgb);
+		return RGBOutput(rgb[0], rgb[1], rgb[2]);
+	}
+};
+
+/** Pixels stored as one palette index each. rotate() shifts every index at
+ *  output time, the palette version of a hue rotation.
+ **/
+class IndexedPixels
+{
+
+protected:
+	uint8_t *_indices;
+	uint16_t _count;
+	uint8_t _offset;
+
+public:
+	IndexedPixels(uint16_t count) : _count(count), _offset(0)
+	{
+		_indices = new uint8_t[count];
+		memset(_indices, 0, count);
+	}
+
+	/** Owns its buffers, copies would free them twice **/
+	IndexedPixels(const IndexedPixels &) = delete;
+	IndexedPixels &operator=(const IndexedPixels &) = delete;
+
+	virtual ~IndexedPixels() { delete[] _indices; }
+
+	uint16_t size() { return _count; }
+
+	uint8_t *indices() { return _indices; }
+
+	void set(uint16_t pixel, uint8_t index)
+	{
+		if (pixel < _count)
+			_indices[pixel] = index;
+	}
+
+	uint8_t get(uint16_t pixel) { return _indices[pixel]; }
+
+	void fill(uint8_t index) { memset(_indices, index, _count); }
+
+	/** Fills indices from @start increasing @step per pixel **/
+	void fillRamp(uint8_t start, uint8_t step)
+	{
+		for (uint16_t n = 0; n < _count; n++, start += step)
+			_indices[n] = start;
+	}
+
+	/** Adds @delta to all indices at output time, wraps naturally **/
+	void rotate(int16_t delta) { _offset += delta; }
+
+	void setOffset(uint8_t offset) { _offset = offset; }
+
+	uint8_t offset() { return _offset; }
+
+	/** Expands to packed RGB, 3 bytes per pixel **/
+	template <uint16_t N>
+	void expand(const ColorPalette<N> &palette, uint8_t *rgb)
+	{
+		for (uint16_t n = 0; n < _count; n++, rgb += 3)
+			palette.lookup(_indices[n] + _offset, rgb);
+	}
+
+	/** Expands into @strip, only changed pixels get sent **/
+	template <uint16_t N>
+	void render(const ColorPalette<N> &palette, RGBStrip &strip)
+	{
+		uint8_t rgb[3];
+		for (uint16_t n = 0; n < _count; n++)
+		{
+			palette.lookup(_indices[n] + _offset, rgb);
+			strip.setPixel(n, rgb[0], rgb[1], rgb[2]);
+		}
+	}
+};
+
+#endif /* PALETTE_H_ */
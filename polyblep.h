@@ -0,0 +1,81 @@
+/*
+ * polyblep.h
+ *
+ * Band limited sawtooth, square and pulse. A polynomial band limited step
+ * (PolyBLEP) smooths each discontinuity over one sample, so waves sampled at a
+ * fixed rate alias far less than the naive shapes for two multiplies per edge.
+ * Phases are [0,1) and dt is the phase increment per sample, frequency / sample rate.
+ */
+
+#ifndef POLYBLEP_H_
+#define POLYBLEP_H_
+
+#include <Arduino.h>
+
+/** Residual to subtract from a unit step at phase 0 **/
+inline float polyblep(float p, float dt)
+{
+	if (p < dt)
+	{
+		p /= dt;
+		return p + p - p * p - 1.0f;
+	}
+	if (p > 1.0f - dt)
+	{
+		p = (p - 1.0f) / dt;
+		return p * p + p + p + 1.0f;
+	}
+	return 0.0f;
+}
+
+/** Rising sawtooth [-1,1] **/
+inline float blep_sawtooth(float p, float dt)
+{
+	return 2.0f * p - 1.0f - polyblep(p, dt);
+}
+
+/** Square [-1,1], high while @p < @k **/
+inline float blep_square(float p, float dt, float k = 0.5f)
+{
+	float fall = p - k;
+	if (fall < 0.0f)
+		fall += 1.0f;
+	return (p < k ? 1.0f : -1.0f) + polyblep(p, dt) - polyblep(fall, dt);
+}
+
+/** Pulse [0,1], high while @p < @k **/
+inline float blep_pulse(float p, float dt, float k = 0.5f)
+{
+	return 0.5f * (blep_square(p, dt, k) + 1.0f);
+}
+
+/** Phase accumulator for sample driven loops, e.g. a timer ISR at PWM rate **/
+class BlepOscillator
+{
+
+public:
+	float phase;
+	float dt;
+
+	BlepOscillator() : phase(0), dt(0) {}
+
+	void setFrequency(float frequency, float sampleRate) { dt = frequency / sampleRate; }
+
+	/** Phase of the current sample, then advances one sample **/
+	float step()
+	{
+		float p = phase;
+		phase += dt;
+		if (phase >= 1.0f)
+			phase -= 1.0f;
+		return p;
+	}
+
+	float sawtooth() { return blep_sawtooth(step(), dt); }
+
+	float square(float k = 0.5f) { return blep_square(step(), dt, k); }
+
+	float pulse(float k = 0.5f) { return blep_pulse(step(), dt, k); }
+};
+
+#endif /* POLYBLEP_H_ */
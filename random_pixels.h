@@ -0,0 +1,139 @@
+/*
+ * random_pixels.h
+ *
+ * Twinkle, sparkle and candle flicker over a whole strip. Each pixel keeps a
+ * level and one byte of program state, random bytes come a step at a time
+ * from parallel generator lanes.
+ */
+
+#ifndef RANDOM_PIXELS_H_
+#define RANDOM_PIXELS_H_
+
+#include <Arduino.h>
+#include "rgb_utils.h"
+#include "color_animation.h"
+#include "xorshift.h"
+
+class RandomPixels
+{
+
+protected:
+	uint16_t _count;
+	uint8_t _program;
+	uint8_t *_level;
+	/** Twinkle speed, sign is the direction, or flicker target level **/
+	int8_t *_state;
+	/** Random bytes of the current step **/
+	uint8_t *_random;
+	XorShiftLanes<4> _rng;
+
+public:
+	/** Chance/256 per pixel and step of a new twinkle or sparkle **/
+	uint8_t density;
+	/** Candle flicker depth, targets fall down to 255 - depth **/
+	uint8_t depth;
+
+	RandomPixels(uint16_t count, uint8_t program = AnimationFunctions::TWINKLE, uint32_t seed = 1)
+		: _count(count), _rng(seed), density(8), depth(96)
+	{
+		_level = new uint8_t[count];
+		_state = new int8_t[count];
+		_random = new uint8_t[count];
+		setProgram(program);
+	}
+
+	/** Owns its buffers, copies would free them twice **/
+	RandomPixels(const RandomPixels &) = delete;
+	RandomPixels &operator=(const RandomPixels &) = delete;
+
+	virtual ~RandomPixels()
+	{
+		delete[] _level;
+		delete[] _state;
+		delete[] _random;
+	}
+
+	/** CANDLE_FLICKER, TWINKLE or SPARKLE from AnimationFunctions **/
+	void setProgram(uint8_t program)
+	{
+		_program = program;
+		uint8_t start = program == AnimationFunctions::CANDLE_FLICKER ? 255 : 0;
+		memset(_level, start, _count);
+		// The candle target is kept as a byte, full level until the first random one
+		memset(_state, start, _count);
+	}
+
+	void seed(uint32_t s) { _rng.seed(s); }
+
+	uint16_t count() { return _count; }
+
+	uint8_t level(uint16_t index) { return _level[index]; }
+
+	/** Advances all pixels one step, call it at a steady rate, e.g. 50 Hz **/
+	void step()
+	{
+		_rng.fill(_random, _count);
+
+		for (uint16_t n = 0; n < _count; n++)
+		{
+			uint8_t r = _random[n];
+			uint8_t l = _level[n];
+			int8_t s = _state[n];
+
+			switch (_program)
+			{
+			case AnimationFunctions::TWINKLE:
+				if (s == 0 && r < density)
+					// Low bits of a lit pixel pick its speed
+					s = 4 + (r & 7);
+				if (s > 0)
+				{
+					if (l >= 255 - s)
+					{
+						l = 255;
+						s = -s;
+					}
+					else
+						l += s;
+				}
+				else if (s < 0)
+				{
+					if (l <= -s)
+					{
+						l = 0;
+						s = 0;
+					}
+					else
+						l += s;
+				}
+				break;
+			case AnimationFunctions::SPARKLE:
+				l = r < density ? 255 : l - ((l >> 2) | (l != 0));
+				break;
+			case AnimationFunctions::CANDLE_FLICKER:
+				// New target about every 8 steps, approached in quarters
+				if ((r & 7) == 0)
+					s = (int8_t)(255 - (r * depth >> 8));
+				l += ((int16_t)(uint8_t)s - l) >> 2;
+				break;
+			}
+
+			_level[n] = l;
+			_state[n] = s;
+		}
+	}
+
+	/** Writes @color scaled by each pixel level to @rgb, 3 bytes per pixel **/
+	void render(uint8_t *rgb, RGBOutput color)
+	{
+		for (uint16_t n = 0; n < _count; n++, rgb += 3)
+		{
+			uint16_t l = _level[n] + 1;
+			rgb[0] = (color.red * l) >> 8;
+			rgb[1] = (color.green * l) >> 8;
+			rgb[2] = (color.blue * l) >> 8;
+		}
+	}
+};
+
+#endif /* RANDOM_PIXELS_H_ */
@@ -7,36 +7,88 @@
 // #include "WProgram.h"
 // #endif
 
-void initPins(const uint8_t *pins, uint8_t size, uint8_t mode)
+inline void initPins(const uint8_t *pins, uint8_t size, uint8_t mode)
 {
 	for (uint8_t n = 0; n < size; n++)
 		pinMode(pins[n], mode);
 }
-void initOutputs(const uint8_t *pins, uint8_t size)
+inline void initOutputs(const uint8_t *pins, uint8_t size)
 {
 	initPins(pins, size, OUTPUT);
 }
-void initInputs(const uint8_t *pins, uint8_t size)
+inline void initInputs(const uint8_t *pins, uint8_t size)
 {
 	initPins(pins, size, INPUT);
 }
 
+/** Output write counters **/
+struct WriteStats
+{
+	unsigned long written;
+	unsigned long skipped;
+
+	void reset() { written = skipped = 0; }
+};
+
+/** Range of modified pixels [first,last] waiting to be sent **/
+struct DirtyRange
+{
+	uint16_t first;
+	uint16_t last;
+
+	DirtyRange() { clear(); }
+
+	bool isDirty() { return first <= last; }
+
+	void clear()
+	{
+		first = 0xFFFF;
+		last = 0;
+	}
+
+	void add(uint16_t index) { add(index, index); }
+
+	void add(uint16_t from, uint16_t to)
+	{
+		if (from < first)
+			first = from;
+		if (to > last)
+			last = to;
+	}
+};
+
 class RGBLed
 {
 
 protected:
 	uint8_t leds[3];
 	bool isCC;
+	uint8_t _last[3];
+	bool _written;
+
 	virtual uint8_t modeValue(uint8_t value) { return (isCC ? value : 255 - value); }
 
+	/** Writes the pins, called only when the color changes **/
+	virtual void output(uint8_t r, uint8_t g, uint8_t b)
+	{
+		analogWrite(leds[0], modeValue(r));
+		analogWrite(leds[1], modeValue(g));
+		analogWrite(leds[2], modeValue(b));
+	}
+
 public:
-	RGBLed() {}
+	/** Counts of pin writes done and skipped because the color was unchanged **/
+	WriteStats stats;
+
+	RGBLed() : _written(false) { stats.reset(); }
 	RGBLed(uint8_t pin_r, uint8_t pin_g, uint8_t pin_b, bool isCommonCathode = true)
+		: RGBLed()
 	{
 		initOutput(pin_r, pin_g, pin_b, isCommonCathode);
 	}
 
 	RGBLed(uint8_t *pins, bool isCommonCathode = true)
+		: RGBLed()
 	{
 		initOutput(pins, isCommonCathode);
 	}
@@ -47,6 +99,7 @@ public:
 		isCC = isCommonCathode;
 		initOutputs(pins, 3);
 		memcpy(leds, pins, 3);
+		invalidate();
 		off();
 	}
 
@@ -56,13 +109,32 @@ public:
 		initOutput(pins, isCommonCathode);
 	}
 
+	/** Writes the color if it differs from the last written one. Still virtual
+	 *  for subclasses that override it, new ones should override output(). **/
 	virtual void write(uint8_t r, uint8_t g, uint8_t b)
 	{
-		analogWrite(leds[0], modeValue(r));
-		analogWrite(leds[1], modeValue(g));
-		analogWrite(leds[2], modeValue(b));
+		if (_written && r == _last[0] && g == _last[1] && b == _last[2])
+		{
+			stats.skipped++;
+			return;
+		}
+		forceWrite(r, g, b);
 	}
 
+	/** Writes the color even if unchanged **/
+	void forceWrite(uint8_t r, uint8_t g, uint8_t b)
+	{
+		output(r, g, b);
+		_last[0] = r;
+		_last[1] = g;
+		_last[2] = b;
+		_written = true;
+		stats.written++;
+	}
+
+	/** Forgets the last written color so next write reaches the pins **/
+	void invalidate() { _written = false; }
+
 	void write(const uint8_t *c) { write(c[0], c[1], c[2]); }
 
 	void write(uint8_t *c) { write(c[0], c[1], c[2]); }
@@ -105,10 +177,15 @@ class DigitalRGBLed : public virtual RGBLed
 {
 
 protected:
-	uint8_t leds[3];
-	bool isCC;
 	virtual uint8_t modeValue(uint8_t value) { return (isCC ? value : !value); }
 
+	virtual void output(uint8_t r, uint8_t g, uint8_t b)
+	{
+		digitalWrite(leds[0], modeValue(r));
+		digitalWrite(leds[1], modeValue(g));
+		digitalWrite(leds[2], modeValue(b));
+	}
+
 public:
 	DigitalRGBLed() : RGBLed() {}
 	DigitalRGBLed(uint8_t pin_r, uint8_t pin_g, uint8_t pin_b, bool isCommonCathode = true)
@@ -120,18 +197,144 @@ public:
 	}
 	virtual ~DigitalRGBLed() {}
 
-	virtual void write(uint8_t r, uint8_t g, uint8_t b)
+	/** Only the 3 byte write is forwarded, the other base overloads would make write(int) ambiguous **/
+	void write(uint8_t r, uint8_t g, uint8_t b) { RGBLed::write(r, g, b); }
+
+	void write(uint8_t digitalColor)
 	{
-		digitalWrite(leds[0], modeValue(r));
-		digitalWrite(leds[1], modeValue(g));
-		digitalWrite(leds[2], modeValue(b));
+		write(bitRead(digitalColor, 0), bitRead(digitalColor, 1), bitRead(digitalColor, 2));
 	}
+};
 
-	void write(uint8_t digitalColor)
+/** Compile time PWM output of an Arduino pin. Pins without a known timer
+ *  compare register fall back to analogWrite. **/
+template <uint8_t PIN>
+struct PWMPin
+{
+	static inline void connect() {}
+	static inline void set(uint8_t value) { analogWrite(PIN, value); }
+};
+
+/** Compile time digital output of an Arduino pin. **/
+template <uint8_t PIN>
+struct DigitalPin
+{
+#if defined(__AVR_ATmega328P__) || defined(__AVR_ATmega328__) || defined(__AVR_ATmega168__)
+	static inline volatile uint8_t &port() { return PIN < 8 ? PORTD : (PIN < 14 ? PORTB : PORTC); }
+	static const uint8_t mask = 1 << (PIN < 8 ? PIN : (PIN < 14 ? PIN - 8 : PIN - 14));
+	static inline void set(bool on)
+	{
+		if (on)
+			port() |= mask;
+		else
+			port() &= ~mask;
+	}
+#else
+	static inline void set(bool on) { digitalWrite(PIN, on ? HIGH : LOW); }
+#endif
+};
+
+/** Binds a pin to its timer compare register, connect() enables the PWM output as analogWrite does **/
+#define RGB_LEDS_PWM_PIN(PIN, TCCR, COM, OCR)               \
+	template <>                                              \
+	struct PWMPin<PIN>                                       \
+	{                                                        \
+		static inline void connect() { TCCR |= _BV(COM); }  \
+		static inline void set(uint8_t value) { OCR = value; } \
+	};
+
+#if defined(__AVR_ATmega328P__) || defined(__AVR_ATmega328__) || defined(__AVR_ATmega168__)
+RGB_LEDS_PWM_PIN(3, TCCR2A, COM2B1, OCR2B)
+RGB_LEDS_PWM_PIN(5, TCCR0A, COM0B1, OCR0B)
+RGB_LEDS_PWM_PIN(6, TCCR0A, COM0A1, OCR0A)
+RGB_LEDS_PWM_PIN(9, TCCR1A, COM1A1, OCR1A)
+RGB_LEDS_PWM_PIN(10, TCCR1A, COM1B1, OCR1B)
+RGB_LEDS_PWM_PIN(11, TCCR2A, COM2A1, OCR2A)
+#elif defined(__AVR_ATmega2560__) || defined(__AVR_ATmega1280__)
+RGB_LEDS_PWM_PIN(2, TCCR3A, COM3B1, OCR3B)
+RGB_LEDS_PWM_PIN(3, TCCR3A, COM3C1, OCR3C)
+RGB_LEDS_PWM_PIN(4, TCCR0A, COM0B1, OCR0B)
+RGB_LEDS_PWM_PIN(5, TCCR3A, COM3A1, OCR3A)
+RGB_LEDS_PWM_PIN(6, TCCR4A, COM4A1, OCR4A)
+RGB_LEDS_PWM_PIN(7, TCCR4A, COM4B1, OCR4B)
+RGB_LEDS_PWM_PIN(8, TCCR4A, COM4C1, OCR4C)
+RGB_LEDS_PWM_PIN(9, TCCR2A, COM2B1, OCR2B)
+RGB_LEDS_PWM_PIN(10, TCCR2A, COM2A1, OCR2A)
+RGB_LEDS_PWM_PIN(11, TCCR1A, COM1A1, OCR1A)
+RGB_LEDS_PWM_PIN(12, TCCR1A, COM1B1, OCR1B)
+RGB_LEDS_PWM_PIN(13, TCCR0A, COM0A1, OCR0A)
+RGB_LEDS_PWM_PIN(44, TCCR5A, COM5C1, OCR5C)
+RGB_LEDS_PWM_PIN(45, TCCR5A, COM5B1, OCR5B)
+RGB_LEDS_PWM_PIN(46, TCCR5A, COM5A1, OCR5A)
+#endif
+
+/** RGB led with pins fixed at compile time. On known AVR boards a write is
+ *  three timer compare register stores, so it can be updated at kHz rates.
+ *  Note a 0 value on a timer0 pin (fast PWM) still outputs a one tick glitch.
+ **/
+template <uint8_t PIN_R, uint8_t PIN_G, uint8_t PIN_B, bool COMMON_CATHODE = true>
+class FastRGBLed
+{
+
+protected:
+	static inline uint8_t modeValue(uint8_t value) { return (COMMON_CATHODE ? value : 255 - value); }
+
+public:
+	/** Sets pins as outputs, connects them to their timers and turns the led off **/
+	void begin()
 	{
-		for (uint8_t n = 0; n < 3; n++)
-			digitalWrite(leds[n], modeValue(bitRead(digitalColor, n)));
+		pinMode(PIN_R, OUTPUT);
+		pinMode(PIN_G, OUTPUT);
+		pinMode(PIN_B, OUTPUT);
+		PWMPin<PIN_R>::connect();
+		PWMPin<PIN_G>::connect();
+		PWMPin<PIN_B>::connect();
+		off();
 	}
+
+	inline void write(uint8_t r, uint8_t g, uint8_t b)
+	{
+		PWMPin<PIN_R>::set(modeValue(r));
+		PWMPin<PIN_G>::set(modeValue(g));
+		PWMPin<PIN_B>::set(modeValue(b));
+	}
+
+	void write(const uint8_t *c) { write(c[0], c[1], c[2]); }
+
+	void write(long c) { write(0xff & c, 0xff & (c >> 8), 0xff & (c >> 16)); }
+
+	void off() { write(0, 0, 0); }
+};
+
+/** Digital RGB led with pins fixed at compile time, a write is three port bit operations on known AVR boards **/
+template <uint8_t PIN_R, uint8_t PIN_G, uint8_t PIN_B, bool COMMON_CATHODE = true>
+class FastDigitalRGBLed
+{
+
+public:
+	/** Sets pins as outputs and turns the led off **/
+	void begin()
+	{
+		pinMode(PIN_R, OUTPUT);
+		pinMode(PIN_G, OUTPUT);
+		pinMode(PIN_B, OUTPUT);
+		// digitalWrite disconnects any PWM timer from the pins
+		digitalWrite(PIN_R, LOW);
+		digitalWrite(PIN_G, LOW);
+		digitalWrite(PIN_B, LOW);
+		off();
+	}
+
+	inline void write(uint8_t r, uint8_t g, uint8_t b)
+	{
+		DigitalPin<PIN_R>::set((r != 0) == COMMON_CATHODE);
+		DigitalPin<PIN_G>::set((g != 0) == COMMON_CATHODE);
+		DigitalPin<PIN_B>::set((b != 0) == COMMON_CATHODE);
+	}
+
+	void write(uint8_t digitalColor) { write(bitRead(digitalColor, 0), bitRead(digitalColor, 1), bitRead(digitalColor, 2)); }
+
+	void off() { write(0, 0, 0); }
 };
 
 #endif /* RGB_LEDS_H_ */
@@ -0,0 +1,173 @@
+/*
+ * rgb_strip.h
+ *
+ * Addressable led strip (WS2812, APA102...) frame buffers.
+ */
+
+#ifndef RGB_STRIP_H_
+#define RGB_STRIP_H_
+
+#include "Arduino.h"
+#include "rgb_utils.h"
+#include "rgb_leds.h"
+
+/** Order of the color bytes sent to the strip **/
+typedef enum
+{
+	ORDER_RGB,
+	ORDER_RBG,
+	ORDER_GRB,
+	ORDER_GBR,
+	ORDER_BRG,
+	ORDER_BGR
+} ColorOrder;
+
+/** Sends frames to a strip. A transport may keep sending in background,
+ *  the frame must not be modified while busy() returns true.
+ **/
+class StripTransport
+{
+public:
+	virtual ~StripTransport() {}
+
+	/** True while the last frame is still being sent **/
+	virtual bool busy() { return false; }
+
+	/** Sends pixels [first, first + count) of @frame, 3 bytes per pixel in strip order.
+	 *  Chained strips may send from pixel 0, pixels after the range keep their colors.
+	 **/
+	virtual void send(const uint8_t *frame, uint16_t first, uint16_t count) = 0;
+};
+
+/** Double buffered strip. Pixels are set in the back buffer, show() swaps
+ *  buffers and hands the front one to the transport so next frame can be
+ *  rendered while the previous one is being sent.
+ **/
+class RGBStrip
+{
+
+protected:
+	uint8_t *_front;
+	uint8_t *_back;
+	uint16_t _count;
+	// Byte offset of red, green and blue inside a pixel
+	uint8_t _r, _g, _b;
+	StripTransport *_transport;
+	DirtyRange _dirty;
+
+public:
+	/** Shown frames and show() calls skipped because nothing changed **/
+	WriteStats stats;
+
+	RGBStrip(uint16_t count, ColorOrder order = ORDER_GRB, StripTransport *transport = NULL)
+	{
+		_count = count;
+		_front = new uint8_t[3 * count];
+		_back = new uint8_t[3 * count];
+		memset(_front, 0, 3 * count);
+		memset(_back, 0, 3 * count);
+		_transport = transport;
+		setColorOrder(order);
+		stats.reset();
+		// First show sends the whole strip
+		_dirty.add(0, count - 1);
+	}
+
+	/** Owns its buffers, copies would free them twice **/
+	RGBStrip(const RGBStrip &) = delete;
+	RGBStrip &operator=(const RGBStrip &) = delete;
+
+	virtual ~RGBStrip()
+	{
+		delete[] _front;
+		delete[] _back;
+	}
+
+	void setTransport(StripTransport *transport) { _transport = transport; }
+
+	void setColorOrder(ColorOrder order)
+	{
+		static const uint8_t offsets[][3] = {{0, 1, 2}, {0, 2, 1}, {1, 0, 2}, {2, 0, 1}, {1, 2, 0}, {2, 1, 0}};
+		_r = offsets[order][0];
+		_g = offsets[order][1];
+		_b = offsets[order][2];
+		_dirty.add(0, _count - 1);
+	}
+
+	/** Number of pixels **/
+	uint16_t size() { return _count; }
+
+	/** Back buffer, 3 bytes per pixel in strip order **/
+	uint8_t *pixels() { return _back; }
+
+	/** Sets pixel @index color, only changed pixels are marked to be sent **/
+	void setPixel(uint16_t index, uint8_t red, uint8_t green, uint8_t blue)
+	{
+		if (index >= _count)
+			return;
+		uint8_t *p = _back + 3 * index;
+		if (p[_r] == red && p[_g] == green && p[_b] == blue)
+			return;
+		p[_r] = red;
+		p[_g] = green;
+		p[_b] = blue;
+		_dirty.add(index);
+	}
+
+	void setPixel(uint16_t index, RGBOutput color) { setPixel(index, color.red, color.green, color.blue); }
+
+	void setPixel(uint16_t index, Color &color) { setPixel(index, color.red(), color.green(), color.blue()); }
+
+	RGBOutput getPixel(uint16_t index)
+	{
+		const uint8_t *p = _back + 3 * index;
+		return RGBOutput(p[_r], p[_g], p[_b]);
+	}
+
+	/** Sets all pixels to the same color **/
+	void fill(uint8_t red, uint8_t green, uint8_t blue)
+	{
+		for (uint16_t n = 0; n < _count; n++)
+			setPixel(n, red, green, blue);
+	}
+
+	void fill(RGBOutput color) { fill(color.red, color.green, color.blue); }
+
+	void clear() { fill(0, 0, 0); }
+
+	/** Marks the whole strip to be sent on next show() **/
+	void invalidate() { _dirty.add(0, _count - 1); }
+
+	/** True if a pixel changed since last show() **/
+	bool isDirty() { return _dirty.isDirty(); }
+
+	/** Sends the changed pixels. Waits for the previous frame if the transport is still busy.
+	 *  @return false if nothing changed and no frame was sent
+	 **/
+	bool show()
+	{
+		if (!_dirty.isDirty() || _transport == NULL)
+		{
+			stats.skipped++;
+			return false;
+		}
+
+		while (_transport->busy())
+			;
+
+		uint8_t *t = _front;
+		_front = _back;
+		_back = t;
+
+		uint16_t count = _dirty.last - _dirty.first + 1;
+		_transport->send(_front, _dirty.first, count);
+
+		// Keep back buffer up to date, only the dirty range differs
+		memcpy(_back + 3 * _dirty.first, _front + 3 * _dirty.first, 3 * count);
+		_dirty.clear();
+		stats.written++;
+		return true;
+	}
+};
+
+#endif /* RGB_STRIP_H_ */
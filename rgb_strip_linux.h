@@ -0,0 +1,257 @@
+/*
+ * rgb_strip_linux.h
+ *
+ * RGBStrip transports for Linux hosts: spidev, files/pipes and a background
+ * sending thread so rendering does not block on the bus.
+ */
+
+#ifndef RGB_STRIP_LINUX_H_
+#define RGB_STRIP_LINUX_H_
+
+#include "rgb_strip.h"
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include <linux/spi/spidev.h>
+
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+typedef enum
+{
+	STRIP_WS2812,
+	STRIP_APA102
+} StripProtocol;
+
+/** Builds the wire bytes of a strip protocol **/
+class StripEncoder
+{
+public:
+	/** WS2812 over SPI at 2.4MHz, each data bit takes 3 SPI bits (1 -> 110, 0 -> 100) **/
+	static void ws2812(const uint8_t *frame, uint16_t count, std::vector<uint8_t> &out)
+	{
+		out.clear();
+		for (uint32_t n = 0; n < 3u * count; n++)
+		{
+			uint32_t bits = 0;
+			for (uint8_t b = 0; b < 8; b++)
+				bits = (bits << 3) | ((frame[n] & (0x80 >> b)) ? 0x6 : 0x4);
+			out.push_back(bits >> 16);
+			out.push_back(bits >> 8);
+			out.push_back(bits);
+		}
+		// Reset/latch, >280us low
+		out.insert(out.end(), 90, 0);
+	}
+
+	/** APA102 start frame, full global brightness per pixel and end frame **/
+	static void apa102(const uint8_t *frame, uint16_t count, std::vector<uint8_t> &out)
+	{
+		out.assign(4, 0);
+		for (uint16_t n = 0; n < count; n++)
+		{
+			out.push_back(0xFF);
+			out.insert(out.end(), frame + 3 * n, frame + 3 * n + 3);
+		}
+		out.insert(out.end(), count / 16 + 1, 0xFF);
+	}
+};
+
+/** Writes frames to a Linux spidev device **/
+class SpidevTransport : public StripTransport
+{
+
+protected:
+	int _fd;
+	uint32_t _speed;
+	uint8_t _protocol;
+	std::vector<uint8_t> _wire;
+
+public:
+	/** @device e.g. "/dev/spidev0.0". Frames must fit the spidev bufsiz module parameter. **/
+	SpidevTransport(const char *device, uint8_t protocol = STRIP_WS2812, uint32_t speedHz = 0)
+	{
+		_protocol = protocol;
+		_speed = speedHz != 0 ? speedHz : (protocol == STRIP_WS2812 ? 2400000 : 4000000);
+		_fd = open(device, O_WRONLY);
+		if (_fd >= 0)
+		{
+			uint8_t mode = SPI_MODE_0;
+			uint8_t bits = 8;
+			ioctl(_fd, SPI_IOC_WR_MODE, &mode);
+			ioctl(_fd, SPI_IOC_WR_BITS_PER_WORD, &bits);
+			ioctl(_fd, SPI_IOC_WR_MAX_SPEED_HZ, &_speed);
+		}
+	}
+
+	virtual ~SpidevTransport()
+	{
+		if (_fd >= 0)
+			close(_fd);
+	}
+
+	bool isOpen() { return _fd >= 0; }
+
+	virtual void send(const uint8_t *frame, uint16_t first, uint16_t count)
+	{
+		if (_fd < 0)
+			return;
+
+		// Chained pixels, send up to the last changed one
+		count += first;
+		if (_protocol == STRIP_APA102)
+			StripEncoder::apa102(frame, count, _wire);
+		else
+			StripEncoder::ws2812(frame, count, _wire);
+
+		struct spi_ioc_transfer transfer;
+		memset(&transfer, 0, sizeof(transfer));
+		transfer.tx_buf = (unsigned long)_wire.data();
+		transfer.len = _wire.size();
+		transfer.speed_hz = _speed;
+		transfer.bits_per_word = 8;
+		ioctl(_fd, SPI_IOC_MESSAGE(1), &transfer);
+	}
+};
+
+/** Writes raw frames (3 bytes per pixel) to a file or a pipe, stands in for a strip on hosts without one.
+ *  Regular files get only the changed range written in place, pipes get the frame up to the last changed pixel.
+ **/
+class FileTransport : public StripTransport
+{
+
+protected:
+	int _fd;
+	bool _ownsFd;
+	bool _seekable;
+
+public:
+	FileTransport(const char *path)
+	{
+		_fd = open(path, O_WRONLY | O_CREAT, 0644);
+		_ownsFd = true;
+		_seekable = _fd >= 0 && lseek(_fd, 0, SEEK_CUR) >= 0;
+	}
+
+	/** Uses an already open descriptor, e.g. STDOUT_FILENO **/
+	FileTransport(int fd)
+	{
+		_fd = fd;
+		_ownsFd = false;
+		_seekable = lseek(_fd, 0, SEEK_CUR) >= 0;
+	}
+
+	virtual ~FileTransport()
+	{
+		if (_ownsFd && _fd >= 0)
+			close(_fd);
+	}
+
+	bool isOpen() { return _fd >= 0; }
+
+	virtual void send(const uint8_t *frame, uint16_t first, uint16_t count)
+	{
+		if (_fd < 0)
+			return;
+
+		if (_seekable)
+		{
+			if (pwrite(_fd, frame + 3 * first, 3 * count, 3 * (off_t)first) < 0)
+				return;
+		}
+		else
+		{
+			size_t len = 3 * ((size_t)first + count);
+			while (len > 0)
+			{
+				ssize_t w = write(_fd, frame, len);
+				if (w <= 0)
+					return;
+				frame += w;
+				len -= w;
+			}
+		}
+	}
+};
+
+/** Sends frames through another transport from a background thread **/
+class AsyncTransport : public StripTransport
+{
+
+protected:
+	StripTransport *_transport;
+	std::thread _thread;
+	std::mutex _mutex;
+	std::condition_variable _cv;
+	const uint8_t *_frame;
+	uint16_t _first, _count;
+	bool _pending;
+	bool _running;
+
+	void run()
+	{
+		std::unique_lock<std::mutex> lock(_mutex);
+		while (true)
+		{
+			_cv.wait(lock, [this] { return _pending || !_running; });
+			if (!_pending)
+				break;
+			const uint8_t *frame = _frame;
+			uint16_t first = _first, count = _count;
+			lock.unlock();
+			_transport->send(frame, first, count);
+			lock.lock();
+			_pending = false;
+			_cv.notify_all();
+		}
+	}
+
+public:
+	AsyncTransport(StripTransport *transport)
+		: _transport(transport), _frame(NULL), _first(0), _count(0), _pending(false), _running(true)
+	{
+		_thread = std::thread(&AsyncTransport::run, this);
+	}
+
+	virtual ~AsyncTransport()
+	{
+		{
+			std::unique_lock<std::mutex> lock(_mutex);
+			_cv.wait(lock, [this] { return !_pending; });
+			_running = false;
+		}
+		_cv.notify_all();
+		_thread.join();
+	}
+
+	virtual bool busy()
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+		return _pending;
+	}
+
+	/** Blocks until the frame being sent is done **/
+	void wait()
+	{
+		std::unique_lock<std::mutex> lock(_mutex);
+		_cv.wait(lock, [this] { return !_pending; });
+	}
+
+	virtual void send(const uint8_t *frame, uint16_t first, uint16_t count)
+	{
+		{
+			std::unique_lock<std::mutex> lock(_mutex);
+			_cv.wait(lock, [this] { return !_pending; });
+			_frame = frame;
+			_first = first;
+			_count = count;
+			_pending = true;
+		}
+		_cv.notify_all();
+	}
+};
+
+#endif /* RGB_STRIP_LINUX_H_ */
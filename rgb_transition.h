@@ -0,0 +1,220 @@
+/*
+ * rgb_transition.h
+ *
+ * Timed color crossfades without allocation, single or pooled for strip
+ * wide fades. Time comes from the Functions clock unless given explicitly.
+ */
+
+#ifndef RGB_TRANSITION_H_
+#define RGB_TRANSITION_H_
+
+#include "Arduino.h"
+#include "rgb_utils.h"
+#include "functions.h"
+#include "easing.h"
+
+/** Progress per millisecond in 0.32 fixed point, elapsed * rate >> 16 is the 16 bit progress **/
+inline uint32_t transition_rate(unsigned long duration)
+{
+	return duration == 0 ? 0 : 0xFFFFFFFFUL / duration;
+}
+
+/** Channel @start + @delta scaled by @progress [0,65535] **/
+inline uint8_t transition_channel(uint8_t start, int16_t delta, uint16_t progress)
+{
+	return start + (int16_t)(((int32_t)delta * progress) >> 16);
+}
+
+class RGBTransition
+{
+
+protected:
+	uint8_t _start[3];
+	int16_t _delta[3];
+	unsigned long _startTime;
+	unsigned long _duration;
+	uint32_t _rate;
+	uint8_t _easing;
+	bool _done;
+	RGBOutput _end;
+
+public:
+	RGBTransition() : _startTime(0), _duration(0), _rate(0), _easing(EASE_LINEAR), _done(true) { memset(_start, 0, 3); memset(_delta, 0, sizeof(_delta)); }
+
+	/** Starts fading from @startV to @endV in @duration ms from @now **/
+	void startAt(unsigned long now, RGBOutput startV, RGBOutput endV, unsigned long duration, uint8_t easing = EASE_LINEAR)
+	{
+		_start[0] = startV.red;
+		_start[1] = startV.green;
+		_start[2] = startV.blue;
+		_delta[0] = (int16_t)endV.red - startV.red;
+		_delta[1] = (int16_t)endV.green - startV.green;
+		_delta[2] = (int16_t)endV.blue - startV.blue;
+		_end = endV;
+		_startTime = now;
+		_duration = duration;
+		_rate = transition_rate(duration);
+		_easing = easing;
+		_done = duration == 0;
+	}
+
+	/** Starts now on the Functions clock **/
+	void start(RGBOutput startV, RGBOutput endV, unsigned long duration, uint8_t easing = EASE_LINEAR)
+	{
+		startAt(Functions::now(), startV, endV, duration, easing);
+	}
+
+	/** Color at @now, the end color once done **/
+	RGBOutput value(unsigned long now)
+	{
+		if (_done)
+			return _end;
+
+		unsigned long elapsed = now - _startTime;
+		if (elapsed >= _duration)
+		{
+			_done = true;
+			return _end;
+		}
+
+		uint16_t p = ease16(_easing, (elapsed * _rate) >> 16);
+		return RGBOutput(transition_channel(_start[0], _delta[0], p),
+						 transition_channel(_start[1], _delta[1], p),
+						 transition_channel(_start[2], _delta[2], p));
+	}
+
+	RGBOutput value() { return _done ? _end : value(Functions::now()); }
+
+	/** True once @now reaches the end time, value() then returns the end color **/
+	bool isDone(unsigned long now)
+	{
+		if (!_done && now - _startTime >= _duration)
+			_done = true;
+		return _done;
+	}
+
+	/** isDone at now on the Functions clock **/
+	bool isDone() { return _done || isDone(Functions::now()); }
+
+	RGBOutput endValue() { return _end; }
+};
+
+/** N transitions in contiguous arrays, e.g. one per strip pixel.
+ *  Idle entries keep their last color and cost a copy per update.
+ **/
+template <uint16_t N>
+class RGBTransitionPool
+{
+
+protected:
+	uint8_t _start[N][3];
+	int16_t _delta[N][3];
+	unsigned long _startTime[N];
+	unsigned long _duration[N];
+	uint32_t _rate[N];
+	uint16_t _active;
+
+public:
+	RGBTransitionPool() : _active(0)
+	{
+		memset(_start, 0, sizeof(_start));
+		memset(_delta, 0, sizeof(_delta));
+		memset(_duration, 0, sizeof(_duration));
+	}
+
+	static const uint16_t SIZE = N;
+
+	/** Number of running transitions **/
+	uint16_t active() { return _active; }
+
+	bool isDone() { return _active == 0; }
+
+	bool isDone(uint16_t i) { return _duration[i] == 0; }
+
+	/** Sets entry @i color with no fade **/
+	void set(uint16_t i, RGBOutput color)
+	{
+		if (_duration[i] != 0)
+			_active--;
+		_start[i][0] = color.red;
+		_start[i][1] = color.green;
+		_start[i][2] = color.blue;
+		_duration[i] = 0;
+	}
+
+	/** Fades entry @i from its current color to @endV in @duration ms from @now **/
+	void start(uint16_t i, RGBOutput endV, unsigned long duration, unsigned long now)
+	{
+		RGBOutput from = value(i, now);
+		start(i, from, endV, duration, now);
+	}
+
+	void start(uint16_t i, RGBOutput startV, RGBOutput endV, unsigned long duration, unsigned long now)
+	{
+		if (duration == 0)
+		{
+			set(i, endV);
+			return;
+		}
+		if (_duration[i] == 0)
+			_active++;
+		_start[i][0] = startV.red;
+		_start[i][1] = startV.green;
+		_start[i][2] = startV.blue;
+		_delta[i][0] = (int16_t)endV.red - startV.red;
+		_delta[i][1] = (int16_t)endV.green - startV.green;
+		_delta[i][2] = (int16_t)endV.blue - startV.blue;
+		_startTime[i] = now;
+		_duration[i] = duration;
+		_rate[i] = transition_rate(duration);
+	}
+
+	/** Entry @i color at @now **/
+	RGBOutput value(uint16_t i, unsigned long now)
+	{
+		if (_duration[i] == 0)
+			return RGBOutput(_start[i][0], _start[i][1], _start[i][2]);
+		unsigned long elapsed = now - _startTime[i];
+		// Ended but not yet idled by update()
+		if (elapsed >= _duration[i])
+			return RGBOutput(_start[i][0] + _delta[i][0], _start[i][1] + _delta[i][1], _start[i][2] + _delta[i][2]);
+		uint16_t p = (elapsed * _rate[i]) >> 16;
+		return RGBOutput(transition_channel(_start[i][0], _delta[i][0], p),
+						 transition_channel(_start[i][1], _delta[i][1], p),
+						 transition_channel(_start[i][2], _delta[i][2], p));
+	}
+
+	/** Writes all N colors at @now to @rgb (3 bytes each), finished transitions become idle **/
+	void update(unsigned long now, uint8_t *rgb)
+	{
+		for (uint16_t i = 0; i < N; i++, rgb += 3)
+		{
+			uint8_t *s = _start[i];
+			if (_duration[i] != 0)
+			{
+				unsigned long elapsed = now - _startTime[i];
+				if (elapsed < _duration[i])
+				{
+					uint16_t p = (elapsed * _rate[i]) >> 16;
+					rgb[0] = transition_channel(s[0], _delta[i][0], p);
+					rgb[1] = transition_channel(s[1], _delta[i][1], p);
+					rgb[2] = transition_channel(s[2], _delta[i][2], p);
+					continue;
+				}
+				// Done, end color becomes the idle color
+				s[0] += _delta[i][0];
+				s[1] += _delta[i][1];
+				s[2] += _delta[i][2];
+				_duration[i] = 0;
+				_active--;
+			}
+			rgb[0] = s[0];
+			rgb[1] = s[1];
+			rgb[2] = s[2];
+		}
+	}
+
+	void update(uint8_t *rgb) { update(Functions::now(), rgb); }
+};
+
+#endif /* RGB_TRANSITION_H_ */
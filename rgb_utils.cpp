@@ -1,14 +1,20 @@
 #include "rgb_utils.h"
+#include <limits.h>
 
 uint16_t hue_in_range(int hue)
 {
-    int h = HUE_MAX +1;
-    while (hue < 0)
-    {
-        hue += (h);
-    }
-
-    return (uint16_t)(hue % (h));
+#if INT_MAX > 32767
+    // Only hosts with 32 bit int and a hardware divide get here
+    if (hue < -32768 || hue > 32767)
+        return ((hue % 360) + 360) % 360;
+#endif
+    // 360 * 92 makes any 16 bit hue positive, keeping the remainder
+    uint32_t u = (int32_t)hue + 360L * 92;
+    // u / 360 by multiply-shift, off by at most one for u < 65888
+    uint16_t q = (u * 11651UL) >> 22;
+    uint16_t r = u - q * 360U;
+    // Branch free r >= 360 ? r - 360 : r
+    return r - (360U & -(uint16_t)(r >= 360));
 }
 
 void temperature_to_rgb(uint16_t kelvin, uint8_t brightness, uint8_t &red, uint8_t &green, uint8_t &blue)
@@ -43,6 +49,53 @@ void temperature_to_rgb(uint16_t kelvin, uint8_t brightness, uint8_t &red, uint8
     blue = map(brightness, 0, 255, 0, (uint8_t)constrain(b, 0, 255));
 }
 
+/** Quadratic in fixed point of t = kelvin - start, fitted by def_temperature.py **/
+struct TemperatureSegment
+{
+    uint16_t start;
+    int32_t a0;
+    int16_t a1;
+    int16_t a2;
+    uint8_t s1;
+    uint8_t s2;
+};
+
+#include "temperature_table.h"
+
+static_assert(TEMPERATURE_TABLE_MIN == TEMPERATURE_FAST_MIN && TEMPERATURE_TABLE_MAX == TEMPERATURE_FAST_MAX, "temperature_table.h range changed");
+
+/** Must match evaluate() in def_temperature.py **/
+static uint8_t temperature_segment(const TemperatureSegment *table, uint8_t count, uint16_t kelvin)
+{
+    // Last segment starting at or below kelvin
+    uint8_t i = count - 1;
+    while (i > 0 && pgm_read_word(&table[i].start) > kelvin)
+        i--;
+    TemperatureSegment s;
+    memcpy_P(&s, &table[i], sizeof(s));
+
+    uint32_t t = kelvin - s.start;
+    int32_t v = s.a0 + (((int32_t)s.a1 * (int32_t)t) >> s.s1) + (((int32_t)s.a2 * (int32_t)((t * t) >> 16)) >> s.s2);
+    v = (v + 128) >> 8;
+    return v < 0 ? 0 : (v > 255 ? 255 : v);
+}
+
+/** @c * @brightness / 255 rounded down as map() does, without a division **/
+static inline uint8_t scale_brightness(uint8_t c, uint8_t brightness)
+{
+    // Unsigned, the int product overflows on AVR
+    uint16_t x = (uint16_t)c * brightness;
+    return (x + 1 + (x >> 8)) >> 8;
+}
+
+void temperature_to_rgb_fast(uint16_t kelvin, uint8_t brightness, uint8_t &red, uint8_t &green, uint8_t &blue)
+{
+    kelvin = constrain(kelvin, TEMPERATURE_TABLE_MIN, TEMPERATURE_TABLE_MAX);
+    red = scale_brightness(temperature_segment(TEMPERATURE_RED, TEMPERATURE_RED_SEGMENTS, kelvin), brightness);
+    green = scale_brightness(temperature_segment(TEMPERATURE_GREEN, TEMPERATURE_GREEN_SEGMENTS, kelvin), brightness);
+    blue = scale_brightness(temperature_segment(TEMPERATURE_BLUE, TEMPERATURE_BLUE_SEGMENTS, kelvin), brightness);
+}
+
 /** From Wikipedia **/
 void hsv_to_rgb(uint16_t hue, uint8_t saturation, uint8_t value, uint8_t &red, uint8_t &green, uint8_t &blue)
 {
@@ -150,6 +203,226 @@ void rgb_to_hsv(uint8_t red, uint8_t green, uint8_t blue, uint16_t &hue, uint8_t
     }
 }
 
+/** [0,65535] to nearest [0,255], x / 257 without a division **/
+static inline uint8_t component8(uint32_t x)
+{
+    return (x - (x >> 8) + 0x80) >> 8;
+}
+
+void hsv16_to_rgb(uint16_t hue16, uint16_t saturation16, uint16_t value16, uint8_t &red, uint8_t &green, uint8_t &blue)
+{
+    // Sector [0,5] and position in it [0,65535]
+    uint32_t h = (uint32_t)hue16 * 6;
+    uint8_t sector = h >> 16;
+    uint32_t f = h & 0xFFFF;
+    uint32_t v = value16;
+    uint32_t s = saturation16;
+
+    // Components with 16 bits
+    uint32_t p = (v * (65536 - s)) >> 16;
+    uint32_t q = (v * (65535 - ((s * f) >> 16))) >> 16;
+    uint32_t t = (v * (65535 - ((s * (65535 - f)) >> 16))) >> 16;
+    uint8_t v8 = component8(v), p8 = component8(p), q8 = component8(q), t8 = component8(t);
+
+    switch (sector)
+    {
+    case 0:
+        red = v8, green = t8, blue = p8;
+        break;
+    case 1:
+        red = q8, green = v8, blue = p8;
+        break;
+    case 2:
+        red = p8, green = v8, blue = t8;
+        break;
+    case 3:
+        red = p8, green = q8, blue = v8;
+        break;
+    case 4:
+        red = t8, green = p8, blue = v8;
+        break;
+    default:
+        red = v8, green = p8, blue = q8;
+        break;
+    }
+}
+
+void rgb_to_hsv16(uint8_t red, uint8_t green, uint8_t blue, uint16_t &hue16, uint16_t &saturation16, uint16_t &value16)
+{
+    uint8_t maxRGB = max(red, max(green, blue));
+    uint8_t minRGB = min(red, min(green, blue));
+    uint8_t delta = maxRGB - minRGB;
+
+    // Unsigned, the int product overflows on AVR for max >= 128
+    value16 = maxRGB * 257U;
+    if (delta == 0)
+    {
+        hue16 = 0;
+        saturation16 = 0;
+        return;
+    }
+    saturation16 = ((uint32_t)delta * 65535 + (maxRGB >> 1)) / maxRGB;
+
+    // A sixth of a turn is 10922.67 binary degrees, offsets of 1/3 and 2/3 turn
+    int32_t h;
+    if (maxRGB == red)
+        h = ((int32_t)green - blue) * 65536 / (6 * delta);
+    else if (maxRGB == green)
+        h = 21845 + ((int32_t)blue - red) * 65536 / (6 * delta);
+    else
+        h = 43691 + ((int32_t)red - green) * 65536 / (6 * delta);
+    // Negative hues wrap by the cast
+    hue16 = (uint16_t)h;
+}
+
+/** sRGB transfer function decoded, generated with c <= 0.04045 ? c / 12.92 : ((c + 0.055) / 1.055)^2.4 **/
+static const float SRGB_TO_LINEAR[256] PROGMEM = {
+    0.0f, 0.000303526984f, 0.000607053967f, 0.000910580951f, 0.00121410793f, 0.00151763492f, 0.0018211619f, 0.00212468888f,
+    0.00242821587f, 0.00273174285f, 0.00303526984f, 0.00334653576f, 0.00367650732f, 0.00402471702f, 0.00439144204f, 0.00477695348f,
+    0.0051815167f, 0.00560539162f, 0.00604883302f, 0.00651209079f, 0.00699541019f, 0.00749903204f, 0.00802319299f, 0.00856812562f,
+    0.0091340587f, 0.00972121732f, 0.010329823f, 0.010960094f, 0.0116122452f, 0.0122864884f, 0.0129830323f, 0.013702083f,
+    0.0144438436f, 0.0152085144f, 0.0159962934f, 0.0168073758f, 0.0176419545f, 0.0185002201f, 0.019382361f, 0.0202885631f,
+    0.0212190104f, 0.0221738848f, 0.0231533662f, 0.0241576324f, 0.0251868596f, 0.0262412219f, 0.0273208916f, 0.0284260395f,
+    0.0295568344f, 0.0307134437f, 0.0318960331f, 0.0331047666f, 0.0343398068f, 0.0356013149f, 0.0368894504f, 0.0382043716f,
+    0.0395462353f, 0.0409151969f, 0.0423114106f, 0.0437350293f, 0.0451862044f, 0.0466650863f, 0.0481718242f, 0.049706566f,
+    0.0512694584f, 0.052860647f, 0.0544802764f, 0.05612849f, 0.0578054302f, 0.0595112382f, 0.0612460542f, 0.0630100177f,
+    0.0648032667f, 0.0666259386f, 0.0684781698f, 0.0703600957f, 0.0722718507f, 0.0742135684f, 0.0761853815f, 0.0781874218f,
+    0.0802198203f, 0.0822827071f, 0.0843762115f, 0.086500462f, 0.0886555863f, 0.0908417112f, 0.0930589628f, 0.0953074666f,
+    0.0975873471f, 0.0998987282f, 0.102241733f, 0.104616484f, 0.107023103f, 0.109461711f, 0.111932428f, 0.114435374f,
+    0.116970668f, 0.119538428f, 0.122138772f, 0.124771818f, 0.12743768f, 0.130136477f, 0.132868322f, 0.13563333f,
+    0.138431615f, 0.141263291f, 0.144128471f, 0.147027266f, 0.14995979f, 0.152926152f, 0.155926464f, 0.158960835f,
+    0.162029376f, 0.165132195f, 0.1682694f, 0.171441101f, 0.174647404f, 0.177888416f, 0.181164244f, 0.184474995f,
+    0.187820772f, 0.191201683f, 0.19461783f, 0.19806932f, 0.201556254f, 0.205078736f, 0.20863687f, 0.212230757f,
+    0.2158605f, 0.2195262f, 0.223227957f, 0.226965874f, 0.230740049f, 0.234550582f, 0.238397574f, 0.242281122f,
+    0.246201327f, 0.250158285f, 0.254152094f, 0.258182853f, 0.262250658f, 0.266355605f, 0.270497791f, 0.274677312f,
+    0.278894263f, 0.28314874f, 0.287440838f, 0.29177065f, 0.296138271f, 0.300543794f, 0.304987314f, 0.309468923f,
+    0.313988713f, 0.318546778f, 0.323143209f, 0.327778098f, 0.332451536f, 0.337163615f, 0.341914425f, 0.346704056f,
+    0.3515326f, 0.356400144f, 0.36130678f, 0.366252596f, 0.37123768f, 0.376262123f, 0.381326011f, 0.386429434f,
+    0.391572478f, 0.396755231f, 0.40197778f, 0.407240212f, 0.412542613f, 0.417885071f, 0.42326767f, 0.428690497f,
+    0.434153636f, 0.439657174f, 0.445201195f, 0.450785783f, 0.456411023f, 0.462077f, 0.467783796f, 0.473531496f,
+    0.479320183f, 0.48514994f, 0.49102085f, 0.496932995f, 0.502886458f, 0.508881321f, 0.514917665f, 0.520995573f,
+    0.527115126f, 0.533276404f, 0.539479489f, 0.545724461f, 0.552011402f, 0.55834039f, 0.564711506f, 0.571124829f,
+    0.57758044f, 0.584078418f, 0.590618841f, 0.597201788f, 0.603827339f, 0.610495571f, 0.617206562f, 0.623960392f,
+    0.630757136f, 0.637596874f, 0.644479682f, 0.651405637f, 0.658374817f, 0.665387298f, 0.672443157f, 0.67954247f,
+    0.686685312f, 0.693871761f, 0.701101892f, 0.70837578f, 0.715693501f, 0.723055129f, 0.73046074f, 0.737910409f,
+    0.74540421f, 0.752942217f, 0.760524505f, 0.768151147f, 0.775822218f, 0.783537792f, 0.79129794f, 0.799102738f,
+    0.806952258f, 0.814846572f, 0.822785754f, 0.830769877f, 0.838799012f, 0.846873232f, 0.854992608f, 0.863157213f,
+    0.871367119f, 0.879622397f, 0.887923118f, 0.896269353f, 0.904661174f, 0.913098652f, 0.921581856f, 0.930110858f,
+    0.938685728f, 0.947306537f, 0.955973353f, 0.964686248f, 0.97344529f, 0.98225055f, 0.991102097f, 1.0f,
+};
+
+float srgb_to_linear(uint8_t c)
+{
+    return pgm_read_float(&SRGB_TO_LINEAR[c]);
+}
+
+uint8_t linear_to_srgb(float l)
+{
+    // Binary search of the decode table, then nearest of the two neighbours
+    uint8_t lo = 0;
+    uint8_t hi = 255;
+    while (lo < hi)
+    {
+        uint8_t mid = (lo + hi) >> 1;
+        if (pgm_read_float(&SRGB_TO_LINEAR[mid]) < l)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+    if (lo > 0 && (l - pgm_read_float(&SRGB_TO_LINEAR[lo - 1])) < (pgm_read_float(&SRGB_TO_LINEAR[lo]) - l))
+        lo--;
+    return lo;
+}
+
+/** Cube root from an exponent bit estimate and two Newton steps **/
+static float fast_cbrt(float x)
+{
+    if (x == 0.0f)
+        return 0.0f;
+    bool negative = x < 0.0f;
+    if (negative)
+        x = -x;
+    union
+    {
+        float f;
+        uint32_t i;
+    } u;
+    u.f = x;
+    u.i = u.i / 3 + 709921077UL;
+    float y = u.f;
+    y = (2.0f * y + x / (y * y)) * (1.0f / 3.0f);
+    y = (2.0f * y + x / (y * y)) * (1.0f / 3.0f);
+    return negative ? -y : y;
+}
+
+/** From Björn Ottosson, https://bottosson.github.io/posts/oklab/ **/
+void rgb_to_oklab(uint8_t red, uint8_t green, uint8_t blue, float &L, float &a, float &b)
+{
+    float r = srgb_to_linear(red);
+    float g = srgb_to_linear(green);
+    float bl = srgb_to_linear(blue);
+
+    float l = fast_cbrt(0.4122214708f * r + 0.5363325363f * g + 0.0514459929f * bl);
+    float m = fast_cbrt(0.2119034982f * r + 0.6806995451f * g + 0.1073969566f * bl);
+    float s = fast_cbrt(0.0883024619f * r + 0.2817188376f * g + 0.6299787005f * bl);
+
+    L = 0.2104542553f * l + 0.7936177850f * m - 0.0040720468f * s;
+    a = 1.9779984951f * l - 2.4285922050f * m + 0.4505937099f * s;
+    b = 0.0259040371f * l + 0.7827717662f * m - 0.8086757660f * s;
+}
+
+/** From Björn Ottosson, out of gamut colors are clipped **/
+void oklab_to_rgb(float L, float a, float b, uint8_t &red, uint8_t &green, uint8_t &blue)
+{
+    float l = L + 0.3963377774f * a + 0.2158037573f * b;
+    float m = L - 0.1055613458f * a - 0.0638541728f * b;
+    float s = L - 0.0894841775f * a - 1.2914855480f * b;
+
+    l = l * l * l;
+    m = m * m * m;
+    s = s * s * s;
+
+    red = linear_to_srgb(+4.0767416621f * l - 3.3077115913f * m + 0.2309699292f * s);
+    green = linear_to_srgb(-1.2684380046f * l + 2.6097574011f * m - 0.3413193965f * s);
+    blue = linear_to_srgb(-0.0041960863f * l - 0.7034186147f * m + 1.7076147010f * s);
+}
+
+void rgb_to_oklab(const uint8_t *rgb, float *lab, uint16_t count)
+{
+    while (count--)
+    {
+        rgb_to_oklab(rgb[0], rgb[1], rgb[2], lab[0], lab[1], lab[2]);
+        rgb += 3;
+        lab += 3;
+    }
+}
+
+void oklab_to_rgb(const float *lab, uint8_t *rgb, uint16_t count)
+{
+    while (count--)
+    {
+        oklab_to_rgb(lab[0], lab[1], lab[2], rgb[0], rgb[1], rgb[2]);
+        rgb += 3;
+        lab += 3;
+    }
+}
+
+void rgb_to_oklch(uint8_t red, uint8_t green, uint8_t blue, float &L, float &C, float &hue)
+{
+    float a, b;
+    rgb_to_oklab(red, green, blue, L, a, b);
+    C = sqrt(a * a + b * b);
+    hue = atan2(b, a) * RAD_TO_DEG;
+    if (hue < 0)
+        hue += 360.0f;
+}
+
+void oklch_to_rgb(float L, float C, float hue, uint8_t &red, uint8_t &green, uint8_t &blue)
+{
+    float h = hue * DEG_TO_RAD;
+    oklab_to_rgb(L, C * cos(h), C * sin(h), red, green, blue);
+}
+
 HSVOutput::HSVOutput()
 {
 }
@@ -178,18 +451,26 @@ RGBOutput HSVOutput::toRGB()
     return o;
 }
 
-RGBOutput::RGBOutput()
+OklabOutput::OklabOutput()
 {
-    red = green = blue = 0;
 }
-RGBOutput::RGBOutput(uint8_t r, uint8_t g, uint8_t b)
+OklabOutput::OklabOutput(float L, float a, float b)
+{
+    this->L = L;
+    this->a = a;
+    this->b = b;
+}
+
+RGBOutput OklabOutput::toRGB()
 {
-    set(r, g, b);
+    return RGBOutput::FROM_OKLAB(L, a, b);
 }
 
-RGBOutput::RGBOutput(uint8_t r, uint8_t g, uint8_t b, uint8_t level, uint8_t maxLevel)
+OklabOutput OklabOutput::LERP(OklabOutput startV, OklabOutput endV, float progress)
 {
-    set(r, g, b, level, maxLevel);
+    return OklabOutput(startV.L + (endV.L - startV.L) * progress,
+                       startV.a + (endV.a - startV.a) * progress,
+                       startV.b + (endV.b - startV.b) * progress);
 }
 
 void RGBOutput::set(uint8_t r, uint8_t g, uint8_t b)
@@ -265,6 +546,13 @@ HSVOutput RGBOutput::toHSV()
     return o;
 }
 
+OklabOutput RGBOutput::toOklab()
+{
+    OklabOutput o;
+    rgb_to_oklab(red, green, blue, o.L, o.a, o.b);
+    return o;
+}
+
 void RGBOutput::setTemperature(uint16_t temperature, uint8_t brightness, uint8_t maxBrightness)
 {
     RGBOutput o = FROM_TEMPERATURE(temperature, brightness, maxBrightness);
@@ -302,11 +590,20 @@ RGBOutput RGBOutput::PROGRESSION100(unsigned long progress100, RGBOutput startV,
 {
     return PROGRESSION(progress100, 0, 100, startV, endV);
 }
+RGBOutput RGBOutput::OKLAB_PROGRESSION(unsigned long progress, unsigned long progressStart, unsigned long progressEnd, OklabOutput startV, OklabOutput endV)
+{
+    if (progress <= progressStart)
+        return startV.toRGB();
+    if (progress >= progressEnd)
+        return endV.toRGB();
+    return OklabOutput::LERP(startV, endV, (float)(progress - progressStart) / (float)(progressEnd - progressStart)).toRGB();
+}
+
 /** Based on Kelvin2RGB library code **/
 RGBOutput RGBOutput::FROM_TEMPERATURE(uint16_t temperature, uint8_t brightness, uint8_t maxBrightness)
 {
     RGBOutput o;
-    temperature_to_rgb(temperature, brightness, (uint8_t &)o.red, (uint8_t &)o.green, (uint8_t &)o.blue);
+    color_temperature_to_rgb(temperature, brightness, (uint8_t &)o.red, (uint8_t &)o.green, (uint8_t &)o.blue);
     return o;
 }
 
@@ -316,3 +613,17 @@ RGBOutput RGBOutput::FROM_HSV(uint16_t hue, uint8_t saturation, uint8_t value)
     hsv_to_rgb(hue, saturation, value, (uint8_t &)o.red, (uint8_t &)o.green, (uint8_t &)o.blue);
     return o;
 }
+
+RGBOutput RGBOutput::FROM_OKLAB(float L, float a, float b)
+{
+    RGBOutput o;
+    oklab_to_rgb(L, a, b, o.red, o.green, o.blue);
+    return o;
+}
+
+RGBOutput RGBOutput::FROM_OKLCH(float L, float C, float hue)
+{
+    RGBOutput o;
+    oklch_to_rgb(L, C, hue, o.red, o.green, o.blue);
+    return o;
+}
\ No newline at end of file
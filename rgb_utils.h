@@ -12,6 +12,12 @@
 #define SATURATION_MAX 255
 #define BRIGHTNESS_MAX 255
 
+/** Set to 1 to keep Color saturation and value in 16 bits, converted with the
+ *  integer kernels. Slow hue sweeps and RGB/HSV round trips keep their precision. **/
+#ifndef RGB_UTILS_HSV16
+#define RGB_UTILS_HSV16 0
+#endif
+
 
 
 struct ColorTone
@@ -48,16 +54,138 @@ struct ColorTone
     static const uint16_t blue_sky = 10000;
 };
 
-/** Returns given @hue in range [0,359] **/
+/** Blends @a towards @b by @amount/256 **/
+inline uint8_t blend8(uint8_t a, uint8_t b, uint8_t amount)
+{
+    return a + (((int16_t)b - a) * amount >> 8);
+}
+
+/** Returns given @hue in range [0,359], constant time with no division **/
 uint16_t hue_in_range(int hue);
+
+/** Binary degrees hue, a full turn is 65536 so rotations wrap by overflow **/
+#define HUE16_PER_DEGREE (65536.0f / 360.0f)
+
+/** Degrees [0,359] to binary degrees, hue16_to_hue() gives them back **/
+constexpr uint16_t hue_to_hue16(uint16_t degrees)
+{
+    // 2^32 / 360, rounded up
+    return ((uint32_t)degrees * 11930465UL + 0xFFFF) >> 16;
+}
+
+/** Binary degrees to degrees [0,359] **/
+constexpr uint16_t hue16_to_hue(uint16_t hue16)
+{
+    return ((uint32_t)hue16 * 360) >> 16;
+}
+
+/** Compile time HSV for constexpr Colors. The float steps are the ones of
+ *  rgb_to_hsv and the integer ones those of rgb_to_hsv16, so results match. **/
+constexpr uint8_t rgb_max(uint8_t r, uint8_t g, uint8_t b)
+{
+    return r > g ? (r > b ? r : b) : (g > b ? g : b);
+}
+
+constexpr uint8_t rgb_min(uint8_t r, uint8_t g, uint8_t b)
+{
+    return r < g ? (r < b ? r : b) : (g < b ? g : b);
+}
+
+/** Component in [0,1] as rgb_to_hsv scales it **/
+constexpr float hsv_unit(uint8_t c)
+{
+    return (float)c / 255.0;
+}
+
+constexpr float hsv_degrees(uint8_t r, uint8_t g, uint8_t b, uint8_t mx, float scale)
+{
+    return mx == r ? (g < b ? (float)(scale * (hsv_unit(g) - hsv_unit(b)) + 360.0) : scale * (hsv_unit(g) - hsv_unit(b)))
+                   : (mx == g ? scale * (hsv_unit(b) - hsv_unit(r)) + 120 : scale * (hsv_unit(r) - hsv_unit(g)) + 240);
+}
+
+/** Hue [0,359] of rgb_to_hsv **/
+constexpr uint16_t hsv_hue(uint8_t r, uint8_t g, uint8_t b, uint8_t mx, uint8_t mn)
+{
+    return mx == mn ? 0 : (uint16_t)hsv_degrees(r, g, b, mx, 60.0 / (hsv_unit(mx) - hsv_unit(mn))) % 360;
+}
+
+/** Saturation [0,255] of rgb_to_hsv **/
+constexpr uint8_t hsv_saturation(uint8_t mx, uint8_t mn)
+{
+    return mx == mn ? 0 : (uint8_t)(255 * (1 - hsv_unit(mn) / hsv_unit(mx)));
+}
+
+/** Hue in binary degrees of rgb_to_hsv16 **/
+constexpr uint16_t hsv16_hue(uint8_t r, uint8_t g, uint8_t b, uint8_t mx, uint8_t mn)
+{
+    return mx == mn ? 0 : (uint16_t)(mx == r ? ((int32_t)g - b) * 65536 / (6 * (mx - mn)) : (mx == g ? 21845 + ((int32_t)b - r) * 65536 / (6 * (mx - mn)) : 43691 + ((int32_t)r - g) * 65536 / (6 * (mx - mn))));
+}
+
+/** Saturation [0,65535] of rgb_to_hsv16 **/
+constexpr uint16_t hsv16_saturation(uint8_t mx, uint8_t mn)
+{
+    return mx == mn ? 0 : ((uint32_t)(mx - mn) * 65535 + (mx >> 1)) / mx;
+}
 /** Convert color temperature in kelvin [0,65500] to RGB **/
 void temperature_to_rgb(uint16_t kelvin, uint8_t brightness, uint8_t &red, uint8_t &green, uint8_t &blue);
+
+/** Range of the temperature_table.h fit **/
+#define TEMPERATURE_FAST_MIN 1000
+#define TEMPERATURE_FAST_MAX 40000
+
+/** temperature_to_rgb from the piecewise tables of def_temperature.py, no pow/log.
+ *  Kelvin is clamped to [1000,40000], within 1 level of temperature_to_rgb there. **/
+void temperature_to_rgb_fast(uint16_t kelvin, uint8_t brightness, uint8_t &red, uint8_t &green, uint8_t &blue);
+
+/** Set to 1 so Color and RGBOutput temperatures in [1000,40000] use temperature_to_rgb_fast,
+ *  off by default as results may differ by 1 level. Other temperatures still use temperature_to_rgb. **/
+#ifndef RGB_UTILS_FAST_TEMPERATURE
+#define RGB_UTILS_FAST_TEMPERATURE 0
+#endif
+
+/** Temperature conversion selected by RGB_UTILS_FAST_TEMPERATURE **/
+inline void color_temperature_to_rgb(uint16_t kelvin, uint8_t brightness, uint8_t &red, uint8_t &green, uint8_t &blue)
+{
+#if RGB_UTILS_FAST_TEMPERATURE
+    if (kelvin >= TEMPERATURE_FAST_MIN && kelvin <= TEMPERATURE_FAST_MAX)
+        temperature_to_rgb_fast(kelvin, brightness, red, green, blue);
+    else
+        temperature_to_rgb(kelvin, brightness, red, green, blue);
+#else
+    temperature_to_rgb(kelvin, brightness, red, green, blue);
+#endif
+}
 /** From Wikipedia **/
 void hsv_to_rgb(uint16_t hue, uint8_t saturation, uint8_t value, uint8_t &red, uint8_t &green, uint8_t &blue);
 
 /** From Wikipedia **/
 void rgb_to_hsv(uint8_t red, uint8_t green, uint8_t blue, uint16_t &hue, uint8_t &saturation, uint8_t &value);
 
+/** Integer HSV to RGB, binary degrees hue, saturation and value [0,65535] **/
+void hsv16_to_rgb(uint16_t hue16, uint16_t saturation16, uint16_t value16, uint8_t &red, uint8_t &green, uint8_t &blue);
+
+/** Integer RGB to HSV, binary degrees hue, saturation and value [0,65535] **/
+void rgb_to_hsv16(uint8_t red, uint8_t green, uint8_t blue, uint16_t &hue16, uint16_t &saturation16, uint16_t &value16);
+
+/** sRGB component [0,255] to linear light [0,1], table lookup **/
+float srgb_to_linear(uint8_t c);
+/** Linear light [0,1] to nearest sRGB component [0,255], binary search of the same table **/
+uint8_t linear_to_srgb(float l);
+
+/** RGB to Oklab, L [0,1] and a,b about [-0.4,0.4] **/
+void rgb_to_oklab(uint8_t red, uint8_t green, uint8_t blue, float &L, float &a, float &b);
+/** Oklab to RGB, out of gamut components are clipped **/
+void oklab_to_rgb(float L, float a, float b, uint8_t &red, uint8_t &green, uint8_t &blue);
+/** Converts @count packed rgb pixels to L,a,b triplets **/
+void rgb_to_oklab(const uint8_t *rgb, float *lab, uint16_t count);
+/** Converts @count L,a,b triplets to packed rgb pixels **/
+void oklab_to_rgb(const float *lab, uint8_t *rgb, uint16_t count);
+
+/** RGB to OkLCh, hue in degrees [0,360) **/
+void rgb_to_oklch(uint8_t red, uint8_t green, uint8_t blue, float &L, float &C, float &hue);
+/** OkLCh to RGB, hue in degrees **/
+void oklch_to_rgb(float L, float C, float hue, uint8_t &red, uint8_t &green, uint8_t &blue);
+
 
 class RGBOutput;
 
@@ -75,6 +203,22 @@ public:
     RGBOutput toRGB();
 };
 
+class OklabOutput
+{
+
+public:
+    float L;
+    float a;
+    float b;
+    OklabOutput();
+    OklabOutput(float L, float a, float b);
+
+    RGBOutput toRGB();
+
+    /** Linear interpolation, @progress in [0,1] **/
+    static OklabOutput LERP(OklabOutput startV, OklabOutput endV, float progress);
+};
+
 class RGBOutput
 {
 public:
@@ -82,11 +226,15 @@ public:
     uint8_t green;
     uint8_t blue;
 
-    RGBOutput();
+    constexpr RGBOutput() : red(0), green(0), blue(0) {}
 
-    RGBOutput(uint8_t r, uint8_t g, uint8_t b);
+    constexpr RGBOutput(uint8_t r, uint8_t g, uint8_t b) : red(r), green(g), blue(b) {}
 
-    RGBOutput(uint8_t r, uint8_t g, uint8_t b, uint8_t level, uint8_t maxLevel = 255);
+    /** Declared since operator= is, copies by value are used throughout **/
+    constexpr RGBOutput(const RGBOutput &other) = default;
+
+    constexpr RGBOutput(uint8_t r, uint8_t g, uint8_t b, uint8_t level, uint8_t maxLevel = 255)
+        : red((r * level) / maxLevel), green((g * level) / maxLevel), blue((b * level) / maxLevel) {}
 
     void set(uint8_t r, uint8_t g, uint8_t b);
 
@@ -109,6 +257,9 @@ public:
 
     HSVOutput toHSV();
 
+    OklabOutput toOklab();
+
+    /** Kelvin [0,65500], converted as Color::setTemperature **/
     void setTemperature(uint16_t temperature, uint8_t brightness = 255, uint8_t maxBrightness = 255);
 
     RGBOutput progressTo(unsigned long progress, unsigned long progressStart, unsigned long progressEnd, RGBOutput endV);
@@ -118,66 +269,100 @@ public:
     static RGBOutput PROGRESSION(unsigned long progress, unsigned long progressStart, unsigned long progressEnd, RGBOutput startV, RGBOutput endV);
 
     static RGBOutput PROGRESSION100(unsigned long progress100, RGBOutput startV, RGBOutput endV);
+
+    /** Like PROGRESSION but interpolating in Oklab, perceived lightness changes evenly **/
+    static RGBOutput OKLAB_PROGRESSION(unsigned long progress, unsigned long progressStart, unsigned long progressEnd, OklabOutput startV, OklabOutput endV);
    
+    /** Kelvin [0,65500], converted as Color::setTemperature **/
     static RGBOutput FROM_TEMPERATURE(uint16_t temperature, uint8_t brightness = 255, uint8_t maxBrightness = 255);
 
     static RGBOutput FROM_HSV(uint16_t hue, uint8_t saturation, uint8_t value);
+
+    /** 0xRRGGBB as Color::toInt() packs it **/
+    static constexpr RGBOutput FROM_HEX(uint32_t hex)
+    {
+        return RGBOutput(hex >> 16, hex >> 8, hex);
+    }
+
+    static RGBOutput FROM_OKLAB(float L, float a, float b);
+
+    static RGBOutput FROM_OKLCH(float L, float C, float hue);
 };
 
-// class RGBTransition : public TimedInterpolationBase<RGBOutput>
-// {
+class Color
+{
+protected:
+    /** Binary degrees **/
+    uint16_t _hue;
+    uint8_t _red, _green, _blue;
 
-// public:
-//     RGBOutput value(RGBOutput &startV, RGBOutput endV, unsigned long transitionTime, bool autoChangeStartV = true)
-//     {
+#if RGB_UTILS_HSV16
+    typedef uint16_t component_t;
+    /** [0,65535] **/
+    component_t _saturation, _brightness;
 
-//         RGBOutput out;
-//         out.set(startV);
-//         unsigned long t = millis();
-//         this->startCheck(startV, endV);
+    // Unsigned, 255 * 257 overflows a 16 bit int and would not be a constant expression
+    static constexpr component_t component(uint8_t v) { return v * 257U; }
+    static constexpr uint8_t componentByte(component_t v) { return v >> 8; }
 
-//         if (this->canCalculate(startV, endV))
-//         {
+    static constexpr uint16_t hsvHue16(uint8_t r, uint8_t g, uint8_t b)
+    {
+        return hsv16_hue(r, g, b, rgb_max(r, g, b), rgb_min(r, g, b));
+    }
 
-//             unsigned long endT = startTime + transitionTime;
-//             out = RGBOutput::PROGRESSION(t, startTime, endT, startV, endV);
-//             // out.red = (uint16_t)mapFromStartToEnd(t, startTime, endT, (unsigned long)startV.red, (unsigned long)endV.red);
-//             // out.green = (uint16_t)mapFromStartToEnd(t, startTime, endT, (unsigned long)startV.green, (unsigned long)endV.green);
-//             // out.blue = (uint16_t)mapFromStartToEnd(t, startTime, endT, (unsigned long)startV.blue, (unsigned long)endV.blue);
-//         }
+    static constexpr component_t hsvSaturation(uint8_t r, uint8_t g, uint8_t b)
+    {
+        return hsv16_saturation(rgb_max(r, g, b), rgb_min(r, g, b));
+    }
 
-//         this->endCheck(out, startV, endV, autoChangeStartV);
+    void updateHSV()
+    {
+        rgb_to_hsv16(_red, _green, _blue, _hue, _saturation, _brightness);
+    }
 
-//         return out;
-//     }
-// };
+    void updateRGB()
+    {
+        hsv16_to_rgb(_hue, _saturation, _brightness, _red, _green, _blue);
+    }
+#else
+    typedef uint8_t component_t;
+    component_t _saturation, _brightness;
 
-class Color
-{
-protected:
-    uint16_t _hue;
-    uint8_t _red, _green, _blue, _saturation, _brightness;
+    static constexpr component_t component(uint8_t v) { return v; }
+    static constexpr uint8_t componentByte(component_t v) { return v; }
+
+    static constexpr uint16_t hsvHue16(uint8_t r, uint8_t g, uint8_t b)
+    {
+        return hue_to_hue16(hsv_hue(r, g, b, rgb_max(r, g, b), rgb_min(r, g, b)));
+    }
+
+    static constexpr component_t hsvSaturation(uint8_t r, uint8_t g, uint8_t b)
+    {
+        return hsv_saturation(rgb_max(r, g, b), rgb_min(r, g, b));
+    }
 
     void updateHSV()
     {
-        rgb_to_hsv(_red, _green, _blue, _hue, _saturation, _brightness);
+        uint16_t hue;
+        rgb_to_hsv(_red, _green, _blue, hue, _saturation, _brightness);
+        _hue = hue_to_hue16(hue);
     }
 
     void updateRGB()
     {
-        hsv_to_rgb(_hue, _saturation, _brightness, _red, _green, _blue);
+        hsv_to_rgb(hue16_to_hue(_hue), _saturation, _brightness, _red, _green, _blue);
     }
+#endif
 
 public:
     /** Default constructor **/
-    Color()
-    {
-        setRGB(0, 0, 0);
-    }
-    /** RGB constructor **/
-    Color(uint8_t red, uint8_t green, uint8_t blue)
+    constexpr Color() : Color(0, 0, 0) {}
+
+    /** RGB constructor, constexpr so Color(COLOR_AMBER) globals need no startup code **/
+    constexpr Color(uint8_t red, uint8_t green, uint8_t blue)
+        : _hue(hsvHue16(red, green, blue)), _red(red), _green(green), _blue(blue),
+          _saturation(hsvSaturation(red, green, blue)), _brightness(component(rgb_max(red, green, blue)))
     {
-        setRGB(red, green, blue);
     }
 
      /** RGB constructor **/
@@ -236,9 +421,23 @@ public:
     /** Sets hue[0,359],saturation[0,255] and value[0,255] components **/
     void setHSV(uint16_t hue, uint8_t saturation, uint8_t value)
     {
-         _hue = hue_in_range(hue);
-        _saturation = saturation;
-        _brightness = value;
+        _hue = hue_to_hue16(hue_in_range(hue));
+        _saturation = component(saturation);
+        _brightness = component(value);
+        updateRGB();
+    }
+
+    /** Sets binary degrees hue, saturation and value [0,65535], 8 bit builds keep the high bytes **/
+    void setHSV16(uint16_t hue16, uint16_t saturation16, uint16_t value16)
+    {
+        _hue = hue16;
+#if RGB_UTILS_HSV16
+        _saturation = saturation16;
+        _brightness = value16;
+#else
+        _saturation = saturation16 >> 8;
+        _brightness = value16 >> 8;
+#endif
         updateRGB();
     }
 
@@ -251,29 +450,42 @@ public:
     /** Sets hue component [0,359] **/
     void setHue(uint16_t hue)
     {
-        _hue = hue_in_range(hue);
+        _hue = hue_to_hue16(hue_in_range(hue));
         updateRGB();
     }
 
+    /** Sets hue in binary degrees [0,65535] **/
+    void setHue16(uint16_t hue)
+    {
+        _hue = hue;
+        updateRGB();
+    }
+
+    /** Rotates hue @delta binary degrees, wraps around by overflow **/
+    void rotateHue16(int16_t delta)
+    {
+        setHue16(_hue + delta);
+    }
+
     /** Sets saturation component [0,255] **/
     void setSaturation(uint8_t saturation)
     {
 
-        _saturation = saturation;
+        _saturation = component(saturation);
         updateRGB();
     }
 
     /** Sets brightness  component [0,255] **/
     void setBrightness(uint8_t brightness)
     {
-        _brightness = brightness;
+        _brightness = component(brightness);
         updateRGB();
     }
 
     /** Set saturation [0,255] */
     void setValue(uint8_t value)
     {
-        _brightness = value;
+        _brightness = component(value);
         updateRGB();
     }
 
@@ -300,10 +512,11 @@ public:
         setRGB( 0xff & (color >> 16),  0xff & (color >> 8),0xff & color);
     }
 
-    /** Sets color temperature (kelvin) [0,65500] and brightness [0,255] **/
+    /** Sets color temperature (kelvin) [0,65500] and brightness [0,255].
+     *  Within 1 level of temperature_to_rgb in [1000,40000] with RGB_UTILS_FAST_TEMPERATURE **/
     void setTemperature(uint16_t kelvin, uint8_t brightness)
     {
-        temperature_to_rgb(kelvin, brightness, _red, _green, _blue);
+        color_temperature_to_rgb(kelvin, brightness, _red, _green, _blue);
         updateHSV();
     }
     /** Sets color temperature (kelvin) [0,65500] **/
@@ -315,25 +528,34 @@ public:
     /** GETTERS **/
 
     /** Gets red component [0,255] **/
-    uint8_t red() { return _red; }
+    constexpr uint8_t red() { return _red; }
 
     /** Gets green component [0,255] **/
-    uint8_t green() { return _green; }
+    constexpr uint8_t green() { return _green; }
 
     /** Gets blue component [0,255] **/
-    uint8_t blue() { return _blue; }
+    constexpr uint8_t blue() { return _blue; }
 
     /** Gets hue component [0,359] **/
-    uint16_t hue() { return _hue; }
+    constexpr uint16_t hue() { return hue16_to_hue(_hue); }
+
+    /** Gets hue in binary degrees [0,65535] **/
+    constexpr uint16_t hue16() { return _hue; }
 
     /** Gets saturation component [0,255] **/
-    uint8_t saturation() { return _saturation; }
+    constexpr uint8_t saturation() { return componentByte(_saturation); }
+
+    /** Gets saturation [0,65535] **/
+    constexpr uint16_t saturation16() { return RGB_UTILS_HSV16 ? _saturation : _saturation * 257U; }
 
     /** Gets brightness component [0,255] **/
-    uint8_t brightness() { return _brightness; }
+    constexpr uint8_t brightness() { return componentByte(_brightness); }
 
     /** Gets value component aka brightness [0,255] **/
-    uint8_t value() { return _brightness; }
+    constexpr uint8_t value() { return componentByte(_brightness); }
+
+    /** Gets value [0,65535] **/
+    constexpr uint16_t value16() { return RGB_UTILS_HSV16 ? _brightness : _brightness * 257U; }
 
     /** Returns RGB as int **/
     unsigned long toInt()
@@ -360,15 +582,47 @@ public:
     /** Returns as HSVOutput **/
     HSVOutput toHSV()
     {
-        return HSVOutput(_hue, _saturation, _brightness);
+        return HSVOutput(hue(), saturation(), value());
     }
     /** Copies hsv to input array **/
     void toHSV(uint16_t *hsv)
     {
-        hsv[0] = _hue;
-        hsv[1] = _saturation;
-        hsv[2] = _brightness;
+        hsv[0] = hue();
+        hsv[1] = saturation();
+        hsv[2] = value();
     }
 };
 
+/** Reads a Color stored with PROGMEM **/
+inline Color color_P(const Color *color)
+{
+    Color c;
+    memcpy_P(&c, color, sizeof(Color));
+    return c;
+}
+
+/** Hex digit value, 0 for other characters **/
+constexpr uint8_t hex_digit(char c)
+{
+    return c >= '0' && c <= '9' ? c - '0' : (c >= 'a' && c <= 'f' ? c - 'a' + 10 : (c >= 'A' && c <= 'F' ? c - 'A' + 10 : 0));
+}
+
+/** Value of @length hex digits, a leading '#' is skipped **/
+constexpr uint32_t hex_value(const char *hex, size_t length, uint32_t value = 0)
+{
+    return length == 0 ? value : (*hex == '#' ? hex_value(hex + 1, length - 1, value) : hex_value(hex + 1, length - 1, (value << 4) | hex_digit(*hex)));
+}
+
+/** 0xFFBF00_rgb, a Color with its HSV computed at compile time **/
+constexpr Color operator"" _rgb(unsigned long long hex)
+{
+    return Color(hex >> 16, hex >> 8, hex);
+}
+
+/** "#ffbf00"_rgb, a Color with its HSV computed at compile time **/
+constexpr Color operator"" _rgb(const char *hex, size_t length)
+{
+    return operator"" _rgb(hex_value(hex, length));
+}
+
 #endif
\ No newline at end of file
@@ -0,0 +1,239 @@
+/*
+ * soft_pwm.h
+ *
+ * Timer interrupt driven software PWM for many RGB leds on arbitrary pins.
+ */
+
+#ifndef SOFT_PWM_H_
+#define SOFT_PWM_H_
+
+#include "Arduino.h"
+#include "rgb_utils.h"
+
+#if defined(__AVR__)
+typedef uint8_t soft_pwm_reg_t;
+#else
+typedef uint32_t soft_pwm_reg_t;
+#endif
+
+/** Software PWM for @LEDS RGB leds (3 channels each) with 8 bit duty.
+ *
+ *  Each period is 256 ticks. Channels are sorted by duty into a table of
+ *  compare events, one event per distinct duty holding the pins toggled on
+ *  every port. tick() does at most one event per call, so the ISR cost does
+ *  not grow with the channel count. The table is double buffered and only
+ *  rebuilt by update() when a duty changed, the ISR swaps it at period start.
+ *
+ *  Usage on AVR:
+ *  	SoftPWM<4> pwm;
+ *  	ISR(TIMER2_COMPA_vect) { pwm.tick(); }
+ *  	setup: pwm.begin(pins); pwm.startTimer2(100);
+ *  	loop: pwm.write(0, r, g, b); pwm.update();
+ **/
+template <uint8_t LEDS>
+class SoftPWM
+{
+public:
+	static const uint8_t CHANNELS = 3 * LEDS;
+	static const uint8_t MAX_PORTS = 4;
+
+protected:
+	struct Event
+	{
+		uint8_t tick;
+		soft_pwm_reg_t toggle[MAX_PORTS];
+	};
+
+	struct Table
+	{
+		soft_pwm_reg_t start[MAX_PORTS];
+		Event events[CHANNELS];
+		uint8_t size;
+	};
+
+	volatile soft_pwm_reg_t *_ports[MAX_PORTS];
+	soft_pwm_reg_t _portMasks[MAX_PORTS];
+	uint8_t _portCount;
+
+	uint8_t _pinPort[CHANNELS];
+	soft_pwm_reg_t _pinMask[CHANNELS];
+	uint8_t _duty[CHANNELS];
+	bool _isCC;
+	bool _dirty;
+
+	Table _tables[2];
+	volatile uint8_t _active;
+	volatile bool _swap;
+
+	// ISR state
+	uint8_t _tick;
+	uint8_t _next;
+
+	/** Fills the inactive table from current duties **/
+	void rebuild(Table &t)
+	{
+		uint8_t order[CHANNELS];
+		uint8_t n, m;
+
+		// Insertion sort of channels by duty, only done when a duty changes
+		for (n = 0; n < CHANNELS; n++)
+		{
+			uint8_t c = n;
+			for (m = n; m > 0 && _duty[order[m - 1]] > _duty[c]; m--)
+				order[m] = order[m - 1];
+			order[m] = c;
+		}
+
+		for (n = 0; n < MAX_PORTS; n++)
+			t.start[n] = 0;
+		t.size = 0;
+
+		for (n = 0; n < CHANNELS; n++)
+		{
+			uint8_t c = order[n];
+			uint8_t duty = _duty[c];
+			uint8_t port = _pinPort[c];
+			bool on = duty > 0;
+
+			if (on == _isCC)
+				t.start[port] |= _pinMask[c];
+
+			// Full on and full off channels never toggle
+			if (duty == 0 || duty == 255)
+				continue;
+
+			if (t.size == 0 || t.events[t.size - 1].tick != duty)
+			{
+				Event &e = t.events[t.size++];
+				e.tick = duty;
+				for (m = 0; m < MAX_PORTS; m++)
+					e.toggle[m] = 0;
+			}
+			t.events[t.size - 1].toggle[port] |= _pinMask[c];
+		}
+	}
+
+public:
+	SoftPWM() : _portCount(0), _isCC(true), _dirty(true), _active(0), _swap(false), _tick(0), _next(0)
+	{
+		memset(_duty, 0, CHANNELS);
+		memset(_tables, 0, sizeof(_tables));
+	}
+
+	/** Sets @pins (r,g,b of each led) as outputs.
+	 *  @return false if pins are spread over more than MAX_PORTS ports
+	 **/
+	bool begin(const uint8_t *pins, bool isCommonCathode = true)
+	{
+		_isCC = isCommonCathode;
+		_portCount = 0;
+		for (uint8_t n = 0; n < MAX_PORTS; n++)
+			_portMasks[n] = 0;
+
+		for (uint8_t n = 0; n < CHANNELS; n++)
+		{
+			pinMode(pins[n], OUTPUT);
+			// Disconnects hardware PWM if any
+			digitalWrite(pins[n], isCommonCathode ? LOW : HIGH);
+
+			volatile soft_pwm_reg_t *port = (volatile soft_pwm_reg_t *)portOutputRegister(digitalPinToPort(pins[n]));
+			uint8_t p = 0;
+			while (p < _portCount && _ports[p] != port)
+				p++;
+			if (p == _portCount)
+			{
+				if (_portCount == MAX_PORTS)
+					return false;
+				_ports[_portCount++] = port;
+			}
+			_pinPort[n] = p;
+			_pinMask[n] = digitalPinToBitMask(pins[n]);
+			_portMasks[p] |= _pinMask[n];
+		}
+
+		_dirty = true;
+		update();
+		return true;
+	}
+
+#if defined(__AVR_ATmega328P__) || defined(__AVR_ATmega328__) || defined(__AVR_ATmega168__) || defined(__AVR_ATmega2560__)
+	/** Runs timer2 in CTC mode at 256 ticks per PWM period. Timer2 hardware PWM pins stop working.
+	 *  @param frequency PWM frequency in Hz, at most ~240Hz at 16MHz
+	 **/
+	void startTimer2(uint16_t frequency)
+	{
+		// Prescaler 8
+		uint32_t top = F_CPU / 8 / (256UL * frequency);
+		noInterrupts();
+		TCCR2A = _BV(WGM21);
+		TCCR2B = _BV(CS21);
+		OCR2A = top > 0 ? (top > 256 ? 255 : top - 1) : 0;
+		TIMSK2 |= _BV(OCIE2A);
+		interrupts();
+	}
+#endif
+
+	/** Sets channel duty [0,255], takes effect after update() **/
+	void setDuty(uint8_t channel, uint8_t duty)
+	{
+		if (channel < CHANNELS && _duty[channel] != duty)
+		{
+			_duty[channel] = duty;
+			_dirty = true;
+		}
+	}
+
+	uint8_t duty(uint8_t channel) { return _duty[channel]; }
+
+	void write(uint8_t led, uint8_t r, uint8_t g, uint8_t b)
+	{
+		setDuty(3 * led, r);
+		setDuty(3 * led + 1, g);
+		setDuty(3 * led + 2, b);
+	}
+
+	void write(uint8_t led, RGBOutput color) { write(led, color.red, color.green, color.blue); }
+
+	void write(uint8_t led, Color &color) { write(led, color.red(), color.green(), color.blue()); }
+
+	/** Rebuilds the event table if a duty changed and the previous one was already taken by the ISR.
+	 *  @return true if a new table was queued
+	 **/
+	bool update()
+	{
+		if (!_dirty || _swap)
+			return false;
+		rebuild(_tables[_active ^ 1]);
+		_dirty = false;
+		_swap = true;
+		return true;
+	}
+
+	/** Advances one of the 256 ticks of the period, call it from the timer ISR **/
+	inline void tick()
+	{
+		if (_tick == 0)
+		{
+			if (_swap)
+			{
+				_active ^= 1;
+				_swap = false;
+			}
+			const Table &t = _tables[_active];
+			for (uint8_t p = 0; p < _portCount; p++)
+				*_ports[p] = (*_ports[p] & ~_portMasks[p]) | t.start[p];
+			_next = 0;
+		}
+
+		const Table &t = _tables[_active];
+		if (_next < t.size && t.events[_next].tick == _tick)
+		{
+			const Event &e = t.events[_next++];
+			for (uint8_t p = 0; p < _portCount; p++)
+				*_ports[p] ^= e.toggle[p];
+		}
+		_tick++;
+	}
+};
+
+#endif /* SOFT_PWM_H_ */
@@ -0,0 +1,38 @@
+#ifndef TEMPERATURE_TABLE_H_
+#define TEMPERATURE_TABLE_H_
+
+// Generated by def_temperature.py, include only from rgb_utils.cpp
+// Max error against temperature_to_rgb r,g,b: 1, 1, 1
+
+#define TEMPERATURE_TABLE_MIN 1000
+#define TEMPERATURE_TABLE_MAX 40000
+
+#define TEMPERATURE_RED_SEGMENTS 4
+static const TemperatureSegment TEMPERATURE_RED[] PROGMEM = {
+    {1000, 64920, 17551, -31428, 20, 17},
+    {6740, 64245, -17248, 30384, 11, 8},
+    {8658, 54096, -31314, 28729, 14, 12},
+    {16226, 45239, -29016, 31604, 16, 16},
+};
+
+#define TEMPERATURE_GREEN_SEGMENTS 6
+static const TemperatureSegment TEMPERATURE_GREEN[] PROGMEM = {
+    {1000, 17014, 25767, -21067, 10, 5},
+    {1235, 22872, 18354, -25897, 10, 7},
+    {2994, 45390, 31096, -19759, 12, 9},
+    {6601, 63985, -20942, 32487, 12, 9},
+    {8976, 56607, -28246, 31902, 15, 14},
+    {22434, 50006, -26555, 25876, 17, 17},
+};
+
+#define TEMPERATURE_BLUE_SEGMENTS 6
+static const TemperatureSegment TEMPERATURE_BLUE[] PROGMEM = {
+    {1000, 334, -16654, 23119, 16, 10},
+    {1931, 661, 19348, -17835, 9, 4},
+    {2107, 6753, 32761, -26644, 10, 5},
+    {2325, 13659, 24282, -16993, 10, 6},
+    {4004, 42575, 22499, -16713, 11, 8},
+    {6601, 65280, 0, 0, 30, 30},
+};
+
+#endif
\ No newline at end of file
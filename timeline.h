@@ -0,0 +1,178 @@
+/*
+ * timeline.h
+ *
+ * Keyframe shows for a ColorAnimation: "fade to amber in 2s, beat for 10s,
+ * then rainbow". Keyframes can live in flash and are played with a cursor,
+ * so each tick only looks at the current keyframe.
+ */
+
+#ifndef TIMELINE_H_
+#define TIMELINE_H_
+
+#include "Arduino.h"
+#include "color_animation.h"
+#include "easing.h"
+
+typedef enum
+{
+	/** Fades from the current color to rgb, param is the easing **/
+	KEYFRAME_FADE,
+	/** Runs ColorAnimation program param **/
+	KEYFRAME_ANIMATION,
+	/** Keeps the current color **/
+	KEYFRAME_HOLD
+} KeyframeAction;
+
+/** Aggregate so shows can be PROGMEM arrays:
+ *  const Keyframe SHOW[] PROGMEM = {
+ *  	{KEYFRAME_FADE, EASE_LINEAR, 200, {COLOR_AMBER}},
+ *  	{KEYFRAME_ANIMATION, AnimationFunctions::BEATING, 1000, {}},
+ *  	{KEYFRAME_ANIMATION, AnimationFunctions::RAINBOW2, 0, {}}};
+ **/
+struct Keyframe
+{
+	uint8_t action;
+	/** Easing curve for KEYFRAME_FADE, program for KEYFRAME_ANIMATION **/
+	uint8_t param;
+	/** In hundredths of second (max ~655s), 0 lasts forever **/
+	uint16_t duration;
+	uint8_t rgb[3];
+};
+
+class Timeline
+{
+
+protected:
+	const Keyframe *_frames;
+	uint8_t _count;
+	bool _progmem;
+	bool _loop;
+	bool _running;
+
+	uint8_t _index;
+	Keyframe _current;
+	unsigned long _start;
+	unsigned long _duration;
+	uint8_t _from[3];
+
+	void load(uint8_t index)
+	{
+		_index = index;
+		if (_progmem)
+			memcpy_P(&_current, &_frames[index], sizeof(Keyframe));
+		else
+			_current = _frames[index];
+		_duration = 10UL * _current.duration;
+	}
+
+	void enter(ColorAnimation &target)
+	{
+		switch (_current.action)
+		{
+		case KEYFRAME_FADE:
+			target.toRGB(_from);
+			target.setAnimation(NO_ANIMATION);
+			if (_duration == 0)
+				target.setRGB(_current.rgb);
+			break;
+		case KEYFRAME_ANIMATION:
+			target.setAnimation(NO_ANIMATION);
+			target.setAnimation(_current.param);
+			// Start from the keyframe time, not from now, so fixtures sharing the clock keep in step
+			target.hueAnimation.resetTimer(_start);
+			target.brightnessAnimation.resetTimer(_start);
+			break;
+		default:
+			break;
+		}
+	}
+
+public:
+	Timeline() : _frames(NULL), _count(0), _progmem(false), _loop(false), _running(false), _index(0) {}
+
+	/** Sets the show, @frames must outlive the timeline **/
+	void begin(const Keyframe *frames, uint8_t count, bool loop = false)
+	{
+		_frames = frames;
+		_count = count;
+		_progmem = false;
+		_loop = loop;
+		_running = false;
+	}
+
+	/** Sets a show stored in PROGMEM **/
+	void begin_P(const Keyframe *frames, uint8_t count, bool loop = false)
+	{
+		begin(frames, count, loop);
+		_progmem = true;
+	}
+
+	/** Starts the show now **/
+	void start(ColorAnimation &target) { start(target, Functions::now()); }
+
+	/** Starts the show at @startTime of the Functions clock, fixtures given the same time play in sync **/
+	void start(ColorAnimation &target, unsigned long startTime)
+	{
+		if (_count == 0)
+			return;
+		_start = startTime;
+		_running = true;
+		load(0);
+		enter(target);
+	}
+
+	void stop() { _running = false; }
+
+	bool isRunning() { return _running; }
+
+	/** Current keyframe index **/
+	uint8_t index() { return _index; }
+
+	/** Advances the show and updates @target, call it every loop.
+	 *  @return false once a non looping show has ended
+	 **/
+	bool update(ColorAnimation &target)
+	{
+		if (_running)
+		{
+			unsigned long elapsed = Functions::now() - _start;
+
+			// Usually no step, several only if ticks were missed
+			while (_duration != 0 && elapsed >= _duration)
+			{
+				if (_current.action == KEYFRAME_FADE)
+					target.setRGB(_current.rgb);
+
+				uint8_t next = _index + 1;
+				if (next >= _count)
+				{
+					if (!_loop)
+					{
+						_running = false;
+						break;
+					}
+					next = 0;
+				}
+				_start += _duration;
+				elapsed -= _duration;
+				load(next);
+				enter(target);
+			}
+
+			if (_running && _current.action == KEYFRAME_FADE && _duration != 0)
+			{
+				uint8_t p = ease8(_current.param, (elapsed << 8) / _duration);
+				target.setRGB(blend8(_from[0], _current.rgb[0], p),
+							  blend8(_from[1], _current.rgb[1], p),
+							  blend8(_from[2], _current.rgb[2], p));
+			}
+		}
+
+		if (target.isAnimating())
+			target.updateAnimation();
+
+		return _running;
+	}
+};
+
+#endif /* TIMELINE_H_ */
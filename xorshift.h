@@ -0,0 +1,105 @@
+/*
+ * xorshift.h
+ *
+ * Small seeded generators, each animator keeps its own state instead of the
+ * global and slower Arduino random().
+ */
+
+#ifndef XORSHIFT_H_
+#define XORSHIFT_H_
+
+#include <Arduino.h>
+
+constexpr uint32_t xorshift_fold(uint32_t z, uint8_t shift) { return z ^ (z >> shift); }
+
+constexpr uint32_t xorshift_nonzero(uint32_t z) { return z != 0 ? z : 0x6D2B79F5UL; }
+
+/** Spreads the bits of a seed, close seeds give unrelated states **/
+constexpr uint32_t xorshift_mix(uint32_t z)
+{
+	return xorshift_nonzero(xorshift_fold(xorshift_fold(xorshift_fold(z + 0x9E3779B9UL, 16) * 0x85EBCA6BUL, 13) * 0xC2B2AE35UL, 16));
+}
+
+/** Marsaglia xorshift32, period 2^32 - 1 **/
+class XorShift32
+{
+
+public:
+	uint32_t state;
+
+	constexpr XorShift32(uint32_t s = 1) : state(xorshift_mix(s)) {}
+
+	void seed(uint32_t s) { state = xorshift_mix(s); }
+
+	uint32_t next()
+	{
+		uint32_t x = state;
+		x ^= x << 13;
+		x ^= x >> 17;
+		x ^= x << 5;
+		return state = x;
+	}
+
+	uint16_t next16() { return next() >> 16; }
+
+	uint8_t next8() { return next() >> 24; }
+
+	/** [0,@n) without a division **/
+	uint16_t below(uint16_t n) { return ((uint32_t)next16() * n) >> 16; }
+
+	/** [@low,@high] **/
+	int16_t range(int16_t low, int16_t high) { return low + below(high - low + 1); }
+
+	/** True with probability @p/256 **/
+	bool chance(uint8_t p) { return next8() < p; }
+
+	/** [0,1) **/
+	float nextFloat() { return (next() >> 8) * (1.0f / 16777216.0f); }
+};
+
+/** @LANES independent xorshift32 generators stepped together, the loops have
+ *  no dependency between lanes so hosts can vectorize them **/
+template <uint8_t LANES>
+class XorShiftLanes
+{
+
+public:
+	uint32_t state[LANES];
+
+	XorShiftLanes(uint32_t s = 1) { seed(s); }
+
+	void seed(uint32_t s)
+	{
+		for (uint8_t n = 0; n < LANES; n++)
+			state[n] = xorshift_mix(s + n * 0x632BE5ABUL);
+	}
+
+	/** Steps every lane, @out gets LANES values **/
+	void next(uint32_t *out)
+	{
+		for (uint8_t n = 0; n < LANES; n++)
+		{
+			uint32_t x = state[n];
+			x ^= x << 13;
+			x ^= x >> 17;
+			x ^= x << 5;
+			out[n] = state[n] = x;
+		}
+	}
+
+	/** Fills @count random bytes **/
+	void fill(uint8_t *bytes, uint16_t count)
+	{
+		uint32_t block[LANES];
+		while (count > 0)
+		{
+			next(block);
+			uint16_t size = count < 4 * LANES ? count : 4 * LANES;
+			memcpy(bytes, block, size);
+			bytes += size;
+			count -= size;
+		}
+	}
+};
+
+#endif /* XORSHIFT_H_ */